@@ -0,0 +1,286 @@
+/*
+ * This code is licensed under the GNU AGPLv3
+ * Copyright (c) 2025 GokbakarE
+ * Date: 28-08-2025
+ */
+
+// Decoder micro-benchmarks. Every stage of turning a halfword into text is
+// timed on its own, for each ISA, over all 65536 encodings and over a
+// realistic instruction mix, and the results are printed as JSON:
+//
+//   {"benchmarks": [{"name": ..., "isa": ..., "input": ..., "insns": ...,
+//                    "ns_per_insn": ..., "allocs_per_insn": ...,
+//                    "insns_per_sec": ...}, ...]}
+//
+// Allocations are counted by the replaced operator new of the
+// allocation-tracking build. With --check, a benchmark allocating more per
+// instruction than its budget in AllocationBudgets is a regression: each one
+// is reported on stderr and the exit status is 1.
+//
+// Run through "make bench", or "make bench-check" for the check.
+
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <fcntl.h>
+#include <random>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "AllocationTracker.hpp"
+#include "DecodeTable.hpp"
+#include "InstructionTable.hpp"
+#include "Listing.hpp"
+#include "OutputWriter.hpp"
+#include "SuperH.hpp"
+#include "SuperH1.hpp"
+#include "SuperH2.hpp"
+#include "SuperH3.hpp"
+#include "SuperH3DSP.hpp"
+#include "SuperH3E.hpp"
+#include "SuperH4.hpp"
+#include "SuperH4A.hpp"
+#include "SuperHDSP.hpp"
+
+static_assert(AllocationTracking, "build the benchmarks with -DDISSH_TRACK_ALLOCATIONS");
+
+// Minimum time each benchmark runs for.
+static constexpr auto MinDuration = std::chrono::milliseconds(100);
+
+// Instructions in the realistic mix.
+static constexpr size_t MixSize = 65536;
+
+struct IsaFunction {
+    ISA isa;
+    const char* name;
+    std::string (*function)(std::string_view);
+};
+
+static constexpr IsaFunction IsaFunctions[IsaCount] = {
+    {ISA::SuperH1, "SuperH1", SuperH1},
+    {ISA::SuperH2, "SuperH2", SuperH2},
+    {ISA::SuperH3, "SuperH3", SuperH3},
+    {ISA::SuperH3E, "SuperH3E", SuperH3E},
+    {ISA::SuperH3DSP, "SuperH3DSP", SuperH3DSP},
+    {ISA::SuperH4, "SuperH4", SuperH4},
+    {ISA::SuperH4A, "SuperH4A", SuperH4A},
+    {ISA::SuperHDSP, "SuperHDSP", SuperHDSP}
+};
+
+// Most allocations per instruction each benchmark may make. The decoder
+// stages and the listing allocate nothing per instruction; the string-based
+// ISA functions return one std::string per call.
+static constexpr struct {
+    std::string_view name;
+    double allocsPerInsn;
+} AllocationBudgets[] = {
+    {"binary_to_word", 0},
+    {"hex_to_word", 0},
+    {"match", 0},
+    {"format", 0},
+    {"decode_render_batch", 0},
+    {"listing", 0.001},
+    {"isa_function", 1}
+};
+
+static bool checkAllocations = false;
+static size_t regressions = 0;
+
+// Keeps results alive so the timed work cannot be optimized away.
+static volatile size_t sink;
+
+static bool firstResult = true;
+
+// Runs body, which processes insns instructions per call, until MinDuration
+// has passed and prints one JSON result.
+template <typename Body>
+static void measure(const char* name, const char* isa, const char* input, size_t insns, Body&& body) {
+    body();  // warm up
+
+    size_t runs = 0;
+    const uint64_t allocationsBefore = threadAllocations().allocations;
+    const auto start = std::chrono::steady_clock::now();
+    auto elapsed = std::chrono::steady_clock::duration{};
+    do {
+        body();
+        ++runs;
+        elapsed = std::chrono::steady_clock::now() - start;
+    } while (elapsed < MinDuration);
+    const uint64_t allocated = threadAllocations().allocations - allocationsBefore;
+
+    const double total = static_cast<double>(runs * insns);
+    const double nanoseconds = std::chrono::duration<double, std::nano>(elapsed).count();
+    std::printf("%s\n    {\"name\": \"%s\", \"isa\": \"%s\", \"input\": \"%s\", \"insns\": %zu, "
+                "\"ns_per_insn\": %.3f, \"allocs_per_insn\": %.3f, \"insns_per_sec\": %.0f}",
+                firstResult ? "" : ",", name, isa, input, runs * insns, nanoseconds / total,
+                static_cast<double>(allocated) / total, total / (nanoseconds / 1e9));
+    firstResult = false;
+
+    if (!checkAllocations) return;
+    for (const auto& budget : AllocationBudgets) {
+        const double allocsPerInsn = static_cast<double>(allocated) / total;
+        if (budget.name != name || allocsPerInsn <= budget.allocsPerInsn) continue;
+        std::fprintf(stderr, "Allocation regression: %s (%s, %s) makes %.4f allocations per instruction, budget %g\n",
+                     name, isa, input, allocsPerInsn, budget.allocsPerInsn);
+        ++regressions;
+    }
+}
+
+// Relative frequency of an instruction form in typical compiled SH code,
+// keyed by mnemonic. Immediate forms, spelled "ADD $I" on the early cores and
+// "ADD #$I" later, are keyed as "ADD #" and fall back to the plain mnemonic.
+// Anything not listed counts 1.
+static unsigned mixWeight(std::string_view assembly) {
+    const size_t space = std::min(assembly.find(' '), assembly.size());
+    const std::string_view mnemonic = assembly.substr(0, space);
+    const std::string_view operands = assembly.substr(std::min(space + 1, assembly.size()));
+    const bool immediate = operands.starts_with("#") || operands.starts_with("$I");
+
+    static constexpr std::pair<std::string_view, unsigned> Weights[] = {
+        {"MOV.L", 40}, {"MOV", 30}, {"MOV.W", 12}, {"MOV.B", 10}, {"MOVA", 3}, {"MOVT", 2},
+        {"ADD", 15}, {"ADD #", 10}, {"CMP/EQ", 8}, {"CMP/HI", 4}, {"CMP/GT", 4}, {"TST", 6},
+        {"BT", 8}, {"BF", 8}, {"BT/S", 4}, {"BF/S", 4}, {"BRA", 6}, {"BSR", 3}, {"JSR", 6},
+        {"RTS", 5}, {"NOP", 4}, {"STS.L", 4}, {"LDS.L", 4}, {"SHLL2", 3}, {"SHLL", 2},
+        {"EXTU.B", 3}, {"EXTU.W", 2}, {"AND", 3}, {"OR", 2}, {"SUB", 3}, {"FMOV", 4},
+        {"FMOV.S", 4}, {"FADD", 2}, {"FMUL", 2}
+    };
+    const auto isImmediateKey = [&](std::string_view name) {
+        return name.size() == mnemonic.size() + 2 && name.starts_with(mnemonic) && name.ends_with(" #");
+    };
+    if (immediate) {
+        for (const auto& [name, weight] : Weights)
+            if (isImmediateKey(name)) return weight;
+    }
+    for (const auto& [name, weight] : Weights)
+        if (name == mnemonic) return weight;
+    return 1;
+}
+
+// A deterministic stream of valid instructions for isa, drawn with mixWeight
+// frequencies and random operand fields.
+static std::vector<uint16_t> realisticMix(ISA isa) {
+    std::vector<OpcodePattern> patterns;
+    std::vector<unsigned> weights;
+    for (size_t opcode = 0; opcode < instructionCount(); ++opcode) {
+        const OpcodeEntry& entry = instructionEntry(static_cast<uint16_t>(opcode));
+        if (!(entry.isas & isaBit(isa))) continue;
+        patterns.push_back(compilePattern(entry.pattern, static_cast<uint16_t>(opcode)));
+        weights.push_back(mixWeight(entry.assembly));
+    }
+
+    std::mt19937 random(0x5348);
+    std::discrete_distribution<size_t> pick(weights.begin(), weights.end());
+    std::vector<uint16_t> words(MixSize);
+    for (uint16_t& word : words) {
+        const OpcodePattern& pattern = patterns[pick(random)];
+        word = static_cast<uint16_t>(pattern.value | (random() & ~pattern.mask));
+    }
+    return words;
+}
+
+static std::vector<uint16_t> allEncodings() {
+    std::vector<uint16_t> words(65536);
+    for (size_t i = 0; i < words.size(); ++i) words[i] = static_cast<uint16_t>(i);
+    return words;
+}
+
+static void benchmarkIsa(const IsaFunction& target, const char* input, const std::vector<uint16_t>& words,
+                         OutputWriter& null) {
+    const ISA isa = target.isa;
+
+    std::vector<std::string> binaryStrings;
+    std::vector<std::string> hexStrings;
+    for (const uint16_t word : words) {
+        std::string binary(16, '0');
+        for (int bit = 0; bit < 16; ++bit)
+            if (word & (0x8000 >> bit)) binary[bit] = '1';
+        binaryStrings.push_back(binary);
+
+        char hex[5];
+        std::snprintf(hex, sizeof hex, "%04x", word);
+        hexStrings.emplace_back(hex, 4);
+    }
+
+    std::vector<DecodedInsn> decoded(words.size());
+    decodeBatch(words, isa, decoded);
+    std::vector<char> text(words.size() * (MaxInsnText + 1));
+
+    measure("binary_to_word", target.name, input, words.size(), [&] {
+        size_t sum = 0;
+        for (const std::string& binary : binaryStrings) sum += *binaryToWord(binary);
+        sink = sum;
+    });
+
+    measure("hex_to_word", target.name, input, words.size(), [&] {
+        size_t sum = 0;
+        for (const std::string& hex : hexStrings) sum += *hexToWord(hex);
+        sink = sum;
+    });
+
+    measure("match", target.name, input, words.size(), [&] {
+        size_t sum = 0;
+        for (const uint16_t word : words) sum += decode(word, isa).opcode;
+        sink = sum;
+    });
+
+    measure("format", target.name, input, words.size(), [&] {
+        char line[MaxInsnText];
+        size_t sum = 0;
+        for (const DecodedInsn& insn : decoded) sum += format(insn, isa, line);
+        sink = sum;
+    });
+
+    measure("decode_render_batch", target.name, input, words.size(), [&] {
+        decodeBatch(words, isa, decoded);
+        sink = renderBatch(decoded, isa, text).length;
+    });
+
+    std::vector<std::byte> bytes(words.size() * 2);
+    for (size_t i = 0; i < words.size(); ++i) {
+        bytes[i * 2] = static_cast<std::byte>(words[i] >> 8);
+        bytes[i * 2 + 1] = static_cast<std::byte>(words[i]);
+    }
+    ListingOptions listing;
+    listing.isa = isa;
+    listing.limit = words.size();
+    listing.address = 0x8C010000;
+    measure("listing", target.name, input, words.size(), [&] {
+        sink = printListing(bytes, listing, null);
+        null.flush();
+    });
+
+    measure("isa_function", target.name, input, words.size(), [&] {
+        size_t sum = 0;
+        for (const std::string& binary : binaryStrings) sum += target.function(binary).size();
+        sink = sum;
+    });
+}
+
+int main(int argc, char* argv[]) {
+    for (int i = 1; i < argc; ++i) {
+        if (std::string_view(argv[i]) == "--check") {
+            checkAllocations = true;
+        } else {
+            std::fprintf(stderr, "Usage: %s [--check]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    const int nullFd = ::open("/dev/null", O_WRONLY | O_CLOEXEC);
+    if (nullFd < 0) {
+        std::perror("Error: /dev/null");
+        return 1;
+    }
+    OutputWriter null(nullFd);
+    const std::vector<uint16_t> all = allEncodings();
+
+    std::printf("{\"benchmarks\": [");
+    for (const IsaFunction& target : IsaFunctions) {
+        benchmarkIsa(target, "all", all, null);
+        benchmarkIsa(target, "mix", realisticMix(target.isa), null);
+    }
+    std::printf("\n]}\n");
+    return regressions > 0 ? 1 : 0;
+}
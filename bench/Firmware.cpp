@@ -0,0 +1,393 @@
+/*
+ * This code is licensed under the GNU AGPLv3
+ * Copyright (c) 2025 GokbakarE
+ * Date: 28-08-2025
+ */
+
+// Synthetic SuperH firmware for benchmarking listings at production scale.
+// The code is a deterministic stream of compiler-shaped functions: prologues
+// and epilogues, integer blocks, PC-relative loads from literal pools placed
+// after each function, calls, forward branches, counted loops and, for ISAs
+// with an FPU, floating-point blocks. The same options always produce the
+// same bytes.
+//
+// Usage: DisSHFirmware.elf <output> [--SuperH*] [--size N[K|M|G]]
+//                          [--endian big|little] [--raw] [--seed N]
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "ByteOrder.hpp"
+#include "SuperH.hpp"
+
+// Load address of the code, the start of cached RAM on SH-3/SH-4 boards.
+static constexpr uint32_t CodeAddress = 0x8C010000;
+
+static constexpr size_t ElfHeaderSize = 52;
+static constexpr size_t SectionHeaderSize = 40;
+static constexpr size_t TextOffset = 64;
+static constexpr uint16_t MachineSuperH = 42;
+
+// Halfwords generated before they are written out.
+static constexpr size_t ChunkWords = 1 << 19;
+
+static constexpr uint16_t Nop = 0x0009;
+
+struct FirmwareOptions {
+    std::string output;
+    ISA isa = ISA::SuperH4;
+    Endian endian = Endian::Big;
+    uint64_t size = 16 << 20;
+    bool raw = false;
+    uint64_t seed = 1;
+};
+
+// splitmix64: small, fast and identical on every platform, unlike the
+// standard distributions.
+class Random {
+public:
+    explicit Random(uint64_t seed) : state_(seed) {}
+
+    uint64_t next() {
+        uint64_t z = (state_ += 0x9E3779B97F4A7C15);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EB;
+        return z ^ (z >> 31);
+    }
+
+    unsigned below(unsigned bound) { return static_cast<unsigned>(next() % bound); }
+
+    // A general register other than R15, the stack pointer.
+    unsigned reg() { return below(15); }
+
+private:
+    uint64_t state_;
+};
+
+static uint16_t encode(unsigned top, unsigned n, unsigned m, unsigned low) {
+    return static_cast<uint16_t>(top << 12 | n << 8 | m << 4 | low);
+}
+
+static bool hasFpu(ISA isa) {
+    return isa == ISA::SuperH3E || isa == ISA::SuperH4 || isa == ISA::SuperH4A;
+}
+
+// Emits one function: its code followed by its 4-byte aligned literal pool.
+// start is the halfword index the function begins at, which is always even.
+class FunctionBuilder {
+public:
+    FunctionBuilder(Random& random, ISA isa) : random_(random), isa_(isa) {}
+
+    void build(std::vector<uint16_t>& out) {
+        const size_t start = out.size();
+        code_.clear();
+        pool_.clear();
+        loads_.clear();
+
+        code_.push_back(encode(0x4, 15, 0x2, 0x2));  // STS.L PR, @-R15
+        code_.push_back(encode(0x2, 15, 14, 0x6));   // MOV.L R14, @-R15
+        code_.push_back(encode(0x6, 14, 15, 0x3));   // MOV R15, R14
+
+        const unsigned blocks = 2 + random_.below(8);
+        for (unsigned i = 0; i < blocks; ++i) {
+            switch (random_.below(hasFpu(isa_) ? 6 : 5)) {
+                case 0: case 1: integerBlock(); break;
+                case 2: callBlock(); break;
+                case 3: branchBlock(); break;
+                case 4: loopBlock(); break;
+                case 5: fpuBlock(); break;
+            }
+        }
+
+        code_.push_back(encode(0x6, 15, 14, 0x3));   // MOV R14, R15
+        code_.push_back(encode(0x6, 14, 15, 0x6));   // MOV.L @R15+, R14
+        code_.push_back(encode(0x4, 15, 0x2, 0x6));  // LDS.L @R15+, PR
+        code_.push_back(0x000B);                     // RTS
+        code_.push_back(Nop);
+        if (code_.size() % 2) code_.push_back(Nop);
+
+        // MOV.L @(disp, PC) reads from (PC & ~3) + 4 + disp * 4.
+        const size_t poolStart = (start + code_.size()) * 2;
+        for (const auto& [index, slot] : loads_) {
+            const size_t pc = (start + index) * 2;
+            const size_t disp = (poolStart + slot * 4 - ((pc & ~size_t{3}) + 4)) / 4;
+            code_[index] = static_cast<uint16_t>(code_[index] | disp);
+        }
+
+        out.insert(out.end(), code_.begin(), code_.end());
+        for (const uint32_t literal : pool_) {
+            out.push_back(static_cast<uint16_t>(literal >> 16));
+            out.push_back(static_cast<uint16_t>(literal));
+        }
+    }
+
+private:
+    // MOV.L @(disp, PC), Rn of a new pool literal; the displacement is filled
+    // in once the pool's position is known.
+    void loadLiteral(unsigned rn, uint32_t literal) {
+        loads_.push_back({code_.size(), pool_.size()});
+        pool_.push_back(literal);
+        code_.push_back(encode(0xD, rn, 0, 0));
+    }
+
+    void integerInsn() {
+        const unsigned n = random_.reg();
+        const unsigned m = random_.reg();
+        switch (random_.below(12)) {
+            case 0: code_.push_back(encode(0x6, n, m, 0x3)); break;                         // MOV Rm, Rn
+            case 1: code_.push_back(static_cast<uint16_t>(0xE000 | n << 8 | random_.below(256))); break;  // MOV #imm, Rn
+            case 2: code_.push_back(encode(0x3, n, m, 0xC)); break;                         // ADD Rm, Rn
+            case 3: code_.push_back(static_cast<uint16_t>(0x7000 | n << 8 | random_.below(256))); break;  // ADD #imm, Rn
+            case 4: code_.push_back(encode(0x3, n, m, 0x8)); break;                         // SUB Rm, Rn
+            case 5: code_.push_back(encode(0x2, n, m, 0x9 + random_.below(3))); break;      // AND, XOR, OR
+            case 6: code_.push_back(encode(0x4, n, 0, random_.below(2) ? 0x8 : 0x9)); break;  // SHLL2, SHLR2
+            case 7: code_.push_back(encode(0x6, n, m, 0xC)); break;                         // EXTU.B Rm, Rn
+            case 8: case 9: code_.push_back(encode(0x5, n, m, random_.below(16))); break;  // MOV.L @(disp, Rm), Rn
+            case 10: code_.push_back(encode(0x1, n, m, random_.below(16))); break;          // MOV.L Rm, @(disp, Rn)
+            case 11: code_.push_back(encode(0x6, n, m, 0x2)); break;                        // MOV.L @Rm, Rn
+        }
+    }
+
+    void integerBlock() {
+        const unsigned count = 3 + random_.below(10);
+        for (unsigned i = 0; i < count; ++i) {
+            if (random_.below(5) == 0) loadLiteral(random_.reg(), static_cast<uint32_t>(random_.next()));
+            else integerInsn();
+        }
+    }
+
+    void callBlock() {
+        const unsigned rn = random_.reg();
+        const uint32_t target = CodeAddress + (static_cast<uint32_t>(random_.next()) & 0x00FFFFFC);
+        loadLiteral(rn, target);
+        code_.push_back(encode(0x4, rn, 0x0, 0xB));  // JSR @Rn
+        code_.push_back(Nop);
+    }
+
+    // CMP/xx Rm, Rn, then BT or BF over the next 1..6 instructions.
+    void branchBlock() {
+        static constexpr unsigned Compares[] = {0x0, 0x2, 0x3, 0x6, 0x7};  // EQ, HS, GE, HI, GT
+        code_.push_back(encode(0x3, random_.reg(), random_.reg(), Compares[random_.below(5)]));
+
+        const unsigned skipped = 1 + random_.below(6);
+        code_.push_back(static_cast<uint16_t>((random_.below(2) ? 0x8900 : 0x8B00) | (skipped - 1)));
+        for (unsigned i = 0; i < skipped; ++i) integerInsn();
+    }
+
+    // A counted loop closed by DT (or ADD #-1 and TST on SH-1) and a backward
+    // BF.
+    void loopBlock() {
+        const unsigned counter = random_.reg();
+        code_.push_back(static_cast<uint16_t>(0xE000 | counter << 8 | (2 + random_.below(64))));
+
+        const size_t top = code_.size();
+        const unsigned count = 2 + random_.below(8);
+        for (unsigned i = 0; i < count; ++i) integerInsn();
+        if (isa_ == ISA::SuperH1) {
+            code_.push_back(static_cast<uint16_t>(0x7000 | counter << 8 | 0xFF));  // ADD #-1, Rn
+            code_.push_back(encode(0x2, counter, counter, 0x8));                   // TST Rn, Rn
+        } else {
+            code_.push_back(encode(0x4, counter, 0x1, 0x0));  // DT Rn
+        }
+
+        // BF lands on PC + 4 + disp * 2.
+        const auto disp = static_cast<int>(top) - static_cast<int>(code_.size()) - 2;
+        code_.push_back(static_cast<uint16_t>(0x8B00 | (disp & 0xFF)));
+    }
+
+    // Loads, arithmetic and a store on the single-precision registers.
+    void fpuBlock() {
+        const unsigned base = random_.reg();
+        const unsigned loads = 2 + random_.below(3);
+        for (unsigned i = 0; i < loads; ++i)
+            code_.push_back(encode(0xF, random_.below(16), base, 0x8));  // FMOV.S @Rm, FRn
+
+        static constexpr unsigned Arithmetic[] = {0x0, 0x1, 0x2, 0x3, 0xC, 0xE};  // FADD FSUB FMUL FDIV FMOV FMAC
+        const unsigned count = 2 + random_.below(8);
+        for (unsigned i = 0; i < count; ++i)
+            code_.push_back(encode(0xF, random_.below(16), random_.below(16), Arithmetic[random_.below(6)]));
+
+        code_.push_back(encode(0xF, base, random_.below(16), 0xA));  // FMOV.S FRm, @Rn
+    }
+
+    Random& random_;
+    ISA isa_;
+    std::vector<uint16_t> code_;
+    std::vector<uint32_t> pool_;
+    std::vector<std::pair<size_t, size_t>> loads_;  // (code index, pool slot)
+};
+
+static void put16(std::byte* out, uint16_t value, Endian endian) {
+    if (endian == Endian::Big) {
+        out[0] = static_cast<std::byte>(value >> 8);
+        out[1] = static_cast<std::byte>(value);
+    } else {
+        out[0] = static_cast<std::byte>(value);
+        out[1] = static_cast<std::byte>(value >> 8);
+    }
+}
+
+static void put32(std::byte* out, uint32_t value, Endian endian) {
+    if (endian == Endian::Big) {
+        put16(out, static_cast<uint16_t>(value >> 16), endian);
+        put16(out + 2, static_cast<uint16_t>(value), endian);
+    } else {
+        put16(out, static_cast<uint16_t>(value), endian);
+        put16(out + 2, static_cast<uint16_t>(value >> 16), endian);
+    }
+}
+
+static void writeBytes(std::ofstream& file, const std::vector<std::byte>& bytes) {
+    if (!file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size())))
+        throw std::runtime_error("Failed to write firmware");
+}
+
+static constexpr std::string_view SectionNames = std::string_view("\0.text\0.shstrtab\0", 17);
+
+// The ELF header and the padding up to TextOffset.
+static std::vector<std::byte> elfHeader(uint32_t textSize, Endian endian) {
+    std::vector<std::byte> header(TextOffset);
+    std::memcpy(header.data(), "\x7F" "ELF", 4);
+    header[4] = std::byte{1};                                   // ELFCLASS32
+    header[5] = std::byte{endian == Endian::Big ? uint8_t{2} : uint8_t{1}};
+    header[6] = std::byte{1};                                   // EV_CURRENT
+
+    const uint32_t sectionOffset = (TextOffset + textSize + SectionNames.size() + 3) & ~3u;
+    put16(&header[16], 2, endian);                              // ET_EXEC
+    put16(&header[18], MachineSuperH, endian);
+    put32(&header[20], 1, endian);
+    put32(&header[24], CodeAddress, endian);                    // entry
+    put32(&header[32], sectionOffset, endian);
+    put16(&header[40], ElfHeaderSize, endian);
+    put16(&header[46], SectionHeaderSize, endian);
+    put16(&header[48], 3, endian);                              // null, .text, .shstrtab
+    put16(&header[50], 2, endian);
+    return header;
+}
+
+// The section names, the padding after them and the section headers.
+static std::vector<std::byte> elfTrailer(uint32_t textSize, Endian endian) {
+    const size_t namesOffset = TextOffset + textSize;
+    const size_t sectionOffset = (namesOffset + SectionNames.size() + 3) & ~size_t{3};
+
+    std::vector<std::byte> trailer(sectionOffset - namesOffset + 3 * SectionHeaderSize);
+    std::memcpy(trailer.data(), SectionNames.data(), SectionNames.size());
+
+    std::byte* text = &trailer[sectionOffset - namesOffset + SectionHeaderSize];
+    put32(text, 1, endian);                                     // ".text"
+    put32(text + 4, 1, endian);                                 // SHT_PROGBITS
+    put32(text + 8, 6, endian);                                 // SHF_ALLOC | SHF_EXECINSTR
+    put32(text + 12, CodeAddress, endian);
+    put32(text + 16, TextOffset, endian);
+    put32(text + 20, textSize, endian);
+    put32(text + 32, 4, endian);                                // alignment
+
+    std::byte* names = text + SectionHeaderSize;
+    put32(names, 7, endian);                                    // ".shstrtab"
+    put32(names + 4, 3, endian);                                // SHT_STRTAB
+    put32(names + 16, static_cast<uint32_t>(namesOffset), endian);
+    put32(names + 20, static_cast<uint32_t>(SectionNames.size()), endian);
+    put32(names + 32, 1, endian);
+    return trailer;
+}
+
+static void generateFirmware(const FirmwareOptions& options) {
+    const uint64_t textSize = options.size & ~uint64_t{1};
+    if (!options.raw && textSize > 0xFFFF0000) throw std::runtime_error("ELF firmware must be smaller than 4 GB");
+
+    std::ofstream file(options.output, std::ios::binary);
+    if (!file) throw std::runtime_error("Failed to open " + options.output);
+    if (!options.raw) writeBytes(file, elfHeader(static_cast<uint32_t>(textSize), options.endian));
+
+    Random random(options.seed);
+    FunctionBuilder builder(random, options.isa);
+    std::vector<uint16_t> words;
+    std::vector<std::byte> bytes;
+    uint64_t remaining = textSize / 2;
+    while (remaining > 0) {
+        // Functions are built at offsets relative to the chunk, which keeps
+        // literal pools aligned because every function has an even length.
+        words.clear();
+        while (words.size() < ChunkWords) builder.build(words);
+
+        const size_t count = static_cast<size_t>(std::min<uint64_t>(words.size(), remaining));
+        bytes.resize(count * 2);
+        for (size_t i = 0; i < count; ++i) put16(&bytes[i * 2], words[i], options.endian);
+        writeBytes(file, bytes);
+        remaining -= count;
+    }
+
+    if (!options.raw) writeBytes(file, elfTrailer(static_cast<uint32_t>(textSize), options.endian));
+    if (!file.flush()) throw std::runtime_error("Failed to write " + options.output);
+}
+
+static uint64_t parseNumber(std::string_view text) {
+    if (text.empty() || text.find_first_not_of("0123456789") != std::string_view::npos)
+        throw std::runtime_error("Invalid number: " + std::string(text));
+    return std::stoull(std::string(text));
+}
+
+// "64", "64K", "64M" or "1G".
+static uint64_t parseSize(std::string_view text) {
+    uint64_t unit = 1;
+    if (!text.empty()) {
+        switch (text.back()) {
+            case 'K': case 'k': unit = 1 << 10; break;
+            case 'M': case 'm': unit = 1 << 20; break;
+            case 'G': case 'g': unit = 1 << 30; break;
+        }
+        if (unit != 1) text.remove_suffix(1);
+    }
+    return parseNumber(text) * unit;
+}
+
+static void printUsage(const char* progName) {
+    std::cerr << "Usage: " << progName << " <output> [--SuperH*] [--size N[K|M|G]] "
+              << "[--endian big|little] [--raw] [--seed N]\n";
+}
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    try {
+        FirmwareOptions options;
+        options.output = argv[1];
+        for (int i = 2; i < argc; ++i) {
+            const std::string_view arg = argv[i];
+            if (const auto isa = isaFromFlag(arg)) {
+                options.isa = *isa;
+            } else if (arg == "--raw") {
+                options.raw = true;
+            } else if ((arg == "--size" || arg == "--endian" || arg == "--seed") && i + 1 < argc) {
+                const std::string_view value = argv[++i];
+                if (arg == "--size") {
+                    options.size = parseSize(value);
+                } else if (arg == "--seed") {
+                    options.seed = parseNumber(value);
+                } else if (const auto endian = endianFromName(value)) {
+                    options.endian = *endian;
+                } else {
+                    throw std::runtime_error("Invalid endian: " + std::string(value));
+                }
+            } else {
+                printUsage(argv[0]);
+                return 1;
+            }
+        }
+        generateFirmware(options);
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}
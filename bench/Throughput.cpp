@@ -0,0 +1,193 @@
+/*
+ * This code is licensed under the GNU AGPLv3
+ * Copyright (c) 2025 GokbakarE
+ * Date: 28-08-2025
+ */
+
+// End-to-end throughput of DisSH listings. Generates synthetic firmware with
+// DisSHFirmware.elf, runs each pipeline stage as its own process and prints
+// JSON with the wall time, MB/s of input and peak RSS of every stage:
+//
+//   {"size": ..., "isa": ..., "runs": ..., "stages": [{"stage": ...,
+//    "seconds": ..., "mb_per_sec": ..., "peak_rss_kb": ...}, ...]}
+//
+// Each stage runs --runs times and the fastest run is reported.
+//
+// Usage: DisSHThroughput.elf [--size N[K|M|G]] [--SuperH*] [--runs N]
+//                            [--binary <DisSH>] [--firmware <generator>]
+//                            [--work <dir>]
+
+#include <sys/resource.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+struct ThroughputOptions {
+    std::string size = "64M";
+    std::string isaFlag = "--SuperH4";
+    unsigned runs = 3;
+    std::string binary = "./DisSH.elf";
+    std::string firmware = "./bench/DisSHFirmware.elf";
+    std::string work = "/tmp";
+};
+
+// Where a stage's standard output goes.
+enum class Sink { Null, File, Pipe };
+
+struct Stage {
+    std::string name;
+    std::vector<std::string> command;
+    Sink sink;
+    std::string input;  // file whose size the MB/s figure is computed from
+};
+
+struct StageResult {
+    double seconds;
+    long peakRssKb;
+};
+
+static uint64_t fileSize(const std::string& path) {
+    struct stat status {};
+    if (stat(path.c_str(), &status) != 0) throw std::runtime_error("Cannot stat " + path);
+    return static_cast<uint64_t>(status.st_size);
+}
+
+// Runs command with its output sent to sink and returns its wall time and
+// peak RSS. Pipe output is read and discarded by this process, the way a
+// consumer such as grep would.
+static StageResult runStage(const Stage& stage, const std::string& outputPath) {
+    int pipeFds[2] = {-1, -1};
+    if (stage.sink == Sink::Pipe && pipe(pipeFds) != 0)
+        throw std::runtime_error(std::string("pipe failed: ") + std::strerror(errno));
+
+    const auto start = std::chrono::steady_clock::now();
+    const pid_t child = fork();
+    if (child < 0) throw std::runtime_error(std::string("fork failed: ") + std::strerror(errno));
+
+    if (child == 0) {
+        int out = -1;
+        switch (stage.sink) {
+            case Sink::Null: out = open("/dev/null", O_WRONLY); break;
+            case Sink::File: out = open(outputPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644); break;
+            case Sink::Pipe: out = pipeFds[1]; close(pipeFds[0]); break;
+        }
+        if (out < 0 || dup2(out, STDOUT_FILENO) < 0) _exit(127);
+
+        std::vector<char*> argv;
+        for (const std::string& arg : stage.command) argv.push_back(const_cast<char*>(arg.c_str()));
+        argv.push_back(nullptr);
+        execv(argv[0], argv.data());
+        _exit(127);
+    }
+
+    if (stage.sink == Sink::Pipe) {
+        close(pipeFds[1]);
+        static char buffer[1 << 16];
+        while (true) {
+            const ssize_t got = read(pipeFds[0], buffer, sizeof buffer);
+            if (got > 0) continue;
+            if (got < 0 && errno == EINTR) continue;
+            break;
+        }
+        close(pipeFds[0]);
+    }
+
+    int status = 0;
+    struct rusage usage {};
+    while (wait4(child, &status, 0, &usage) < 0) {
+        if (errno != EINTR) throw std::runtime_error(std::string("wait4 failed: ") + std::strerror(errno));
+    }
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    if (!WIFEXITED(status) || WEXITSTATUS(status) != 0)
+        throw std::runtime_error("Stage " + stage.name + " failed: " + stage.command[0]);
+    return {std::chrono::duration<double>(elapsed).count(), usage.ru_maxrss};
+}
+
+static std::vector<Stage> pipelineStages(const ThroughputOptions& options) {
+    const std::string elf = options.work + "/DisSHFirmware.elf.bin";
+    const std::string raw = options.work + "/DisSHFirmware.raw.bin";
+    const std::string& isa = options.isaFlag;
+    const std::string& dissh = options.binary;
+
+    return {
+        {"generate_elf", {options.firmware, elf, isa, "--size", options.size}, Sink::Null, elf},
+        {"generate_raw", {options.firmware, raw, isa, "--size", options.size, "--raw"}, Sink::Null, raw},
+        {"elf_to_null", {dissh, "--file", elf, isa, "--number", "all"}, Sink::Null, elf},
+        {"elf_to_file", {dissh, "--file", elf, isa, "--number", "all"}, Sink::File, elf},
+        {"elf_to_pipe", {dissh, "--file", elf, isa, "--number", "all"}, Sink::Pipe, elf},
+        {"elf_jobs_to_null", {dissh, "--file", elf, isa, "--number", "all", "--jobs", "0"}, Sink::Null, elf},
+        {"raw_to_null", {dissh, "--raw", raw, isa, "--number", "all"}, Sink::Null, raw}
+    };
+}
+
+static void printUsage(const char* progName) {
+    std::cerr << "Usage: " << progName << " [--size N[K|M|G]] [--SuperH*] [--runs N] "
+              << "[--binary <DisSH>] [--firmware <generator>] [--work <dir>]\n";
+}
+
+int main(int argc, char* argv[]) {
+    ThroughputOptions options;
+    for (int i = 1; i < argc; ++i) {
+        const std::string_view arg = argv[i];
+        if (arg.starts_with("--SuperH")) {
+            options.isaFlag = arg;
+        } else if (i + 1 < argc && arg == "--size") {
+            options.size = argv[++i];
+        } else if (i + 1 < argc && arg == "--runs") {
+            options.runs = static_cast<unsigned>(std::max(1, std::atoi(argv[++i])));
+        } else if (i + 1 < argc && arg == "--binary") {
+            options.binary = argv[++i];
+        } else if (i + 1 < argc && arg == "--firmware") {
+            options.firmware = argv[++i];
+        } else if (i + 1 < argc && arg == "--work") {
+            options.work = argv[++i];
+        } else {
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+
+    try {
+        const std::string listing = options.work + "/DisSHFirmware.DisSH";
+        const std::vector<Stage> stages = pipelineStages(options);
+
+        std::printf("{\"size\": \"%s\", \"isa\": \"%s\", \"runs\": %u, \"stages\": [",
+                    options.size.c_str(), options.isaFlag.c_str() + 2, options.runs);
+        for (size_t i = 0; i < stages.size(); ++i) {
+            const Stage& stage = stages[i];
+            StageResult best{0, 0};
+            for (unsigned run = 0; run < options.runs; ++run) {
+                const StageResult result = runStage(stage, listing);
+                if (run == 0 || result.seconds < best.seconds) best.seconds = result.seconds;
+                best.peakRssKb = std::max(best.peakRssKb, result.peakRssKb);
+            }
+
+            const double megabytes = static_cast<double>(fileSize(stage.input)) / (1 << 20);
+            std::printf("%s\n    {\"stage\": \"%s\", \"seconds\": %.3f, \"mb_per_sec\": %.1f, \"peak_rss_kb\": %ld}",
+                        i ? "," : "", stage.name.c_str(), best.seconds, megabytes / best.seconds, best.peakRssKb);
+            std::fflush(stdout);
+        }
+        std::printf("\n]}\n");
+
+        unlink(listing.c_str());
+        for (const Stage& stage : stages) unlink(stage.input.c_str());
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}
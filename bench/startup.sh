@@ -0,0 +1,40 @@
+#!/bin/sh
+#This code is licensed under the GNU AGPLv3
+#Copyright (c) 2025 GokbakarE
+#Date: 28-08-2025
+
+# Measures the startup cost of the single-word CLI form, the way scripts call
+# it in a loop. Prints the mean wall time per run next to that of /bin/true,
+# which is the fork/exec floor on this machine.
+#
+# Usage: bench/startup.sh [binary] [runs]
+
+BINARY=${1:-./DisSH.elf}
+RUNS=${2:-500}
+
+if [ ! -x "$BINARY" ]; then
+    echo "No executable at $BINARY; run make first." >&2
+    exit 1
+fi
+
+# Mean microseconds per run of the given command.
+measure() {
+    start=$(date +%s%N)
+    i=0
+    while [ $i -lt "$RUNS" ]; do
+        "$@" > /dev/null
+        i=$((i + 1))
+    done
+    end=$(date +%s%N)
+    echo $(((end - start) / RUNS / 1000))
+}
+
+floor=$(measure /bin/true)
+single=$(measure "$BINARY" --SuperH4 1100001111000011)
+other=$(measure "$BINARY" --SuperHDSP 1111000000000000)
+
+echo "runs:                $RUNS"
+echo "/bin/true:           $floor us/run"
+echo "--SuperH4 word:      $single us/run"
+echo "--SuperHDSP word:    $other us/run"
+echo "startup over floor:  $((single - floor)) us/run"
@@ -0,0 +1,54 @@
+#!/bin/sh
+#This code is licensed under the GNU AGPLv3
+#Copyright (c) 2025 GokbakarE
+#Date: 28-08-2025
+
+# Checks that streaming standard input with --jobs keeps memory flat: lists,
+# and counts with --histogram, a small and a large random image through
+# "--raw -" and fails when the large run's peak RSS exceeds the small one's
+# by more than the slack. Peak RSS is read from the --stats report of the
+# allocation-tracking build.
+#
+# Usage: bench/stream-memory.sh [binary] [jobs] [small MB] [large MB] [slack KB]
+
+BINARY=${1:-./DisSHAlloc.elf}
+JOBS=${2:-4}
+SMALL=${3:-4}
+LARGE=${4:-32}
+SLACK=${5:-8192}
+
+if [ ! -x "$BINARY" ]; then
+    echo "No executable at $BINARY; run make alloc first." >&2
+    exit 1
+fi
+
+DIR=$(mktemp -d) || exit 1
+trap 'rm -rf "$DIR"' EXIT
+
+head -c $((SMALL << 20)) /dev/urandom > "$DIR/small"
+head -c $((LARGE << 20)) /dev/urandom > "$DIR/large"
+
+# Peak RSS in KB of one run over the given image.
+peak() {
+    image=$1
+    shift
+    "$BINARY" --raw - --jobs "$JOBS" --number all --stats --trace "$DIR/trace.json" "$@" \
+        < "$image" 2>&1 > /dev/null | sed -n 's/.* \([0-9][0-9]*\) KB peak$/\1/p'
+}
+
+status=0
+for mode in listing histogram; do
+    if [ $mode = histogram ]; then set -- --histogram json; else set --; fi
+    small=$(peak "$DIR/small" "$@")
+    large=$(peak "$DIR/large" "$@")
+    if [ -z "$small" ] || [ -z "$large" ]; then
+        echo "$mode: no peak RSS in the --stats report of $BINARY" >&2
+        exit 1
+    fi
+    echo "$mode: ${SMALL} MB peak ${small} KB, ${LARGE} MB peak ${large} KB"
+    if [ $((large - small)) -gt "$SLACK" ]; then
+        echo "$mode: peak RSS grew by $((large - small)) KB, slack $SLACK KB" >&2
+        status=1
+    fi
+done
+exit $status
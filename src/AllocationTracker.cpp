@@ -0,0 +1,79 @@
+/*
+ * This code is licensed under the GNU AGPLv3
+ * Copyright (c) 2025 GokbakarE
+ * Date: 28-08-2025
+ */
+
+#include "AllocationTracker.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#include <sys/resource.h>
+
+// Per-thread counts are plain increments; the process totals are relaxed
+// atomics, which only need to be exact once the threads are done.
+static thread_local AllocationCounts threadCounts;
+static std::atomic<uint64_t> processCount = 0;
+static std::atomic<uint64_t> processBytes = 0;
+
+AllocationCounts threadAllocations() noexcept {
+    return threadCounts;
+}
+
+AllocationCounts processAllocations() noexcept {
+    return {processCount.load(std::memory_order_relaxed), processBytes.load(std::memory_order_relaxed)};
+}
+
+uint64_t peakRssKb() noexcept {
+    rusage usage{};
+    if (::getrusage(RUSAGE_SELF, &usage) != 0) return 0;
+#if defined(__APPLE__)
+    return static_cast<uint64_t>(usage.ru_maxrss) / 1024;  // bytes on macOS
+#else
+    return static_cast<uint64_t>(usage.ru_maxrss);
+#endif
+}
+
+#if defined(DISSH_TRACK_ALLOCATIONS)
+
+static void countAllocation(size_t size) noexcept {
+    ++threadCounts.allocations;
+    threadCounts.bytes += size;
+    processCount.fetch_add(1, std::memory_order_relaxed);
+    processBytes.fetch_add(size, std::memory_order_relaxed);
+}
+
+// The array and nothrow forms of the library forward to these, so replacing
+// the single-object forms counts every allocation.
+void* operator new(size_t size) {
+    countAllocation(size);
+    if (void* memory = std::malloc(size ? size : 1)) return memory;
+    throw std::bad_alloc();
+}
+
+void* operator new(size_t size, std::align_val_t alignment) {
+    countAllocation(size);
+    const size_t align = static_cast<size_t>(alignment);
+    if (void* memory = std::aligned_alloc(align, (size + align - 1) / align * align)) return memory;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* memory) noexcept {
+    std::free(memory);
+}
+
+void operator delete(void* memory, size_t) noexcept {
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::align_val_t) noexcept {
+    std::free(memory);
+}
+
+void operator delete(void* memory, size_t, std::align_val_t) noexcept {
+    std::free(memory);
+}
+
+#endif
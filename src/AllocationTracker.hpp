@@ -0,0 +1,37 @@
+/*
+ * This code is licensed under the GNU AGPLv3
+ * Copyright (c) 2025 GokbakarE
+ * Date: 28-08-2025
+ */
+
+#pragma once
+#ifndef ALLOCATIONTRACKER_H
+#define ALLOCATIONTRACKER_H
+
+#include <cstdint>
+
+// The allocation-tracking build flavor, compiled with
+// -DDISSH_TRACK_ALLOCATIONS ("make alloc"), replaces the global operator new
+// and delete with counting versions. Regular builds keep the library's
+// allocator and all counts read zero.
+#if defined(DISSH_TRACK_ALLOCATIONS)
+inline constexpr bool AllocationTracking = true;
+#else
+inline constexpr bool AllocationTracking = false;
+#endif
+
+struct AllocationCounts {
+    uint64_t allocations = 0;
+    uint64_t bytes = 0;
+};
+
+// Allocations made by the calling thread so far.
+AllocationCounts threadAllocations() noexcept;
+
+// Allocations made by every thread so far.
+AllocationCounts processAllocations() noexcept;
+
+// High-water mark of the process's resident set so far, in KB.
+uint64_t peakRssKb() noexcept;
+
+#endif
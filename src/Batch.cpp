@@ -0,0 +1,163 @@
+/*
+ * This code is licensed under the GNU AGPLv3
+ * Copyright (c) 2025 GokbakarE
+ * Date: 28-08-2025
+ */
+
+#include "Batch.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <mutex>
+#include <numeric>
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "ElfFile.hpp"
+#include "OutputWriter.hpp"
+#include "TaskPool.hpp"
+
+namespace fs = std::filesystem;
+
+static bool hasElfMagic(const fs::path& path) {
+    char magic[4] = {};
+    std::ifstream file(path, std::ios::binary);
+    return file.read(magic, sizeof magic) && std::memcmp(magic, "\x7F" "ELF", sizeof magic) == 0;
+}
+
+static fs::path listingName(fs::path path) {
+    return path += ".DisSH";
+}
+
+// Longest directory both a and b lie in.
+static fs::path commonDirectory(const fs::path& a, const fs::path& b) {
+    fs::path common;
+    for (auto i = a.begin(), j = b.begin(); i != a.end() && j != b.end() && *i == *j; ++i, ++j) common /= *i;
+    return common;
+}
+
+// Fails when two inputs would be listed to the same file, which also catches
+// an input listed twice.
+static void checkListingNames(const std::vector<BatchInput>& inputs) {
+    std::vector<const BatchInput*> sorted;
+    for (const BatchInput& input : inputs) sorted.push_back(&input);
+    std::sort(sorted.begin(), sorted.end(), [](const BatchInput* a, const BatchInput* b) { return a->listing < b->listing; });
+    const auto duplicate = std::adjacent_find(sorted.begin(), sorted.end(),
+                                              [](const BatchInput* a, const BatchInput* b) { return a->listing == b->listing; });
+    if (duplicate != sorted.end())
+        throw std::runtime_error("Batch inputs " + (*duplicate)->path.string() + " and " + duplicate[1]->path.string() +
+                                 " would both be listed to " + (*duplicate)->listing.string());
+}
+
+std::vector<BatchInput> batchInputs(const fs::path& source) {
+    std::vector<BatchInput> inputs;
+    std::error_code error;
+
+    if (fs::is_directory(source, error)) {
+        for (const auto& entry : fs::recursive_directory_iterator(source, error)) {
+            if (!entry.is_regular_file() || entry.path().extension() == ".DisSH" || !hasElfMagic(entry.path()))
+                continue;
+            inputs.push_back({entry.path(), listingName(entry.path().lexically_relative(source)), entry.file_size()});
+        }
+        if (error) throw std::runtime_error("Failed to read directory: " + source.string() + " (" + error.message() + ")");
+        return inputs;
+    }
+
+    std::ifstream list(source);
+    if (!list) throw std::runtime_error("Failed to open batch list: " + source.string());
+
+    // Listings keep each input's path below the directory all inputs share,
+    // so equal file names in different directories stay apart.
+    std::vector<fs::path> absolutePaths;
+    std::string line;
+    while (std::getline(list, line)) {
+        if (!line.empty() && line.back() == '\r') line.pop_back();
+        if (line.empty() || line[0] == '#') continue;
+
+        const fs::path path = line;
+        const uintmax_t size = fs::file_size(path, error);
+        inputs.push_back({path, {}, error ? 0 : size});
+        absolutePaths.push_back(fs::absolute(path).lexically_normal());
+    }
+    if (inputs.empty()) return inputs;
+
+    fs::path root = absolutePaths[0].parent_path();
+    for (const fs::path& path : absolutePaths) root = commonDirectory(root, path.parent_path());
+    for (size_t i = 0; i < inputs.size(); ++i) inputs[i].listing = listingName(absolutePaths[i].lexically_relative(root));
+    checkListingNames(inputs);
+    return inputs;
+}
+
+static void listInput(const BatchInput& input, const fs::path& output, const BatchOptions& options) {
+    Tracer* const tracer = options.listing.tracer;
+    const TraceSpan fileSpan(tracer, "list file", input.size);
+    std::optional<ElfFile> loaded;
+    {
+        const TraceSpan span(tracer, "load file", input.size);
+        loaded.emplace(input.path.string());
+    }
+    const ElfFile& elf = *loaded;
+
+    std::vector<const ElfSection*> sections;
+    {
+        const TraceSpan span(tracer, "section lookup");
+        if (options.section) {
+            const ElfSection* found = elf.findSection(*options.section);
+            if (!found) throw std::runtime_error("Section not found: " + *options.section);
+            sections.push_back(found);
+        } else {
+            sections = elf.codeSections();
+        }
+    }
+
+    ListingOptions listing = options.listing;
+    listing.endian = options.endian.value_or(elf.bigEndian() ? Endian::Big : Endian::Little);
+    listing.jobs = 1;
+
+    if (output.has_parent_path()) fs::create_directories(output.parent_path());
+    const int fd = ::open(output.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd < 0) throw std::runtime_error("Failed to create " + output.string() + " (" + std::strerror(errno) + ")");
+
+    try {
+        OutputWriter out(fd, OutputMode::Write);
+        out.trackStats(listing.stats);
+        out.traceFlushes(tracer);
+        printListing(elf, sections, listing, out);
+        out.flush();
+    } catch (...) {
+        ::close(fd);
+        throw;
+    }
+    ::close(fd);
+}
+
+size_t runBatch(const std::vector<BatchInput>& inputs, const BatchOptions& options, std::ostream& errors) {
+    // Largest first, so the work-stealing pool deals the big files out before
+    // the small ones.
+    std::vector<size_t> order(inputs.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(),
+                     [&](size_t a, size_t b) { return inputs[a].size > inputs[b].size; });
+
+    std::atomic<size_t> failed = 0;
+    std::mutex errorsMutex;
+
+    runTasks(order.size(), options.threads, [&](size_t task) {
+        const BatchInput& input = inputs[order[task]];
+        const fs::path output = options.outputDir ? *options.outputDir / input.listing
+                                                  : input.path.parent_path() / input.listing.filename();
+        try {
+            listInput(input, output, options);
+        } catch (const std::exception& e) {
+            ++failed;
+            std::lock_guard lock(errorsMutex);
+            errors << "Error: " << input.path.string() << ": " << e.what() << "\n";
+        }
+    });
+    return failed;
+}
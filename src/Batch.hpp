@@ -0,0 +1,54 @@
+/*
+ * This code is licensed under the GNU AGPLv3
+ * Copyright (c) 2025 GokbakarE
+ * Date: 28-08-2025
+ */
+
+#pragma once
+#ifndef BATCH_H
+#define BATCH_H
+
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "ByteOrder.hpp"
+#include "Listing.hpp"
+
+struct BatchInput {
+    std::filesystem::path path;
+    // Where the listing goes, relative to the output directory.
+    std::filesystem::path listing;
+    uintmax_t size;
+};
+
+// Collects the inputs of a batch. source is either a directory, searched
+// recursively for ELF files, or a list file naming one input per line; blank
+// lines and lines starting with '#' are skipped. Listings are named after
+// their input plus ".DisSH", keeping the layout below a source directory or
+// below the directory all listed files share. Throws std::runtime_error when
+// source cannot be read or two inputs would share a listing.
+std::vector<BatchInput> batchInputs(const std::filesystem::path& source);
+
+struct BatchOptions {
+    ListingOptions listing;
+    // Overrides the byte order in each file's header.
+    std::optional<Endian> endian;
+    // Section to list; all code sections when not given.
+    std::optional<std::string> section;
+    // Directory the listings are written below; next to each input when not
+    // given.
+    std::optional<std::filesystem::path> outputDir;
+    unsigned threads = 1;
+};
+
+// Writes the listing of every input to its own file, spreading the inputs
+// over a work-stealing pool. options.listing.jobs is ignored; files are the
+// unit of parallelism. A failing input is reported to errors and does not
+// stop the others. Returns the number of inputs that failed.
+size_t runBatch(const std::vector<BatchInput>& inputs, const BatchOptions& options, std::ostream& errors);
+
+#endif
@@ -0,0 +1,39 @@
+/*
+ * This code is licensed under the GNU AGPLv3
+ * Copyright (c) 2025 GokbakarE
+ * Date: 28-08-2025
+ */
+
+#include "ByteOrder.hpp"
+
+#include <bit>
+#include <cstring>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+std::optional<Endian> endianFromName(std::string_view name) {
+    if (name == "big") return Endian::Big;
+    if (name == "little") return Endian::Little;
+    return std::nullopt;
+}
+
+static void swapHalfwords(uint16_t* words, size_t count) noexcept {
+    size_t i = 0;
+#if defined(__SSE2__)
+    for (; i + 8 <= count; i += 8) {
+        auto* lane = reinterpret_cast<__m128i*>(words + i);
+        const __m128i v = _mm_loadu_si128(lane);
+        _mm_storeu_si128(lane, _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8)));
+    }
+#endif
+    for (; i < count; ++i) words[i] = static_cast<uint16_t>(words[i] << 8 | words[i] >> 8);
+}
+
+void loadHalfwords(const std::span<const std::byte> bytes, const Endian endian, const std::span<uint16_t> words) noexcept {
+    std::memcpy(words.data(), bytes.data(), words.size_bytes());
+
+    const Endian host = std::endian::native == std::endian::big ? Endian::Big : Endian::Little;
+    if (endian != host) swapHalfwords(words.data(), words.size());
+}
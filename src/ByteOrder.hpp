@@ -0,0 +1,29 @@
+/*
+ * This code is licensed under the GNU AGPLv3
+ * Copyright (c) 2025 GokbakarE
+ * Date: 28-08-2025
+ */
+
+#pragma once
+#ifndef BYTEORDER_H
+#define BYTEORDER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string_view>
+
+// Byte order of the instruction halfwords in a code image.
+enum class Endian : uint8_t { Big, Little };
+
+// Parses "big" or "little".
+std::optional<Endian> endianFromName(std::string_view name);
+
+// Loads words.size() halfwords stored in the given byte order from bytes,
+// which must hold at least twice that many bytes, into host order. When the
+// image and host byte orders differ the whole block is swapped in one
+// vectorized pass rather than word by word.
+void loadHalfwords(std::span<const std::byte> bytes, Endian endian, std::span<uint16_t> words) noexcept;
+
+#endif
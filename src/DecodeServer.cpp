@@ -0,0 +1,412 @@
+/*
+ * This code is licensed under the GNU AGPLv3
+ * Copyright (c) 2025 GokbakarE
+ * Date: 28-08-2025
+ */
+
+#include "DecodeServer.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <csignal>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <unordered_map>
+
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#if defined(__linux__)
+#include <sys/epoll.h>
+#include <sys/signalfd.h>
+#endif
+
+#if !defined(__linux__)
+// Elsewhere only the client is built, and it does without these.
+#define MSG_NOSIGNAL 0
+#define SOCK_CLOEXEC 0
+#endif
+
+static std::runtime_error systemError(const std::string& what) {
+    return std::runtime_error(what + " (" + std::strerror(errno) + ")");
+}
+
+static uint32_t loadBig32(const uint8_t* p) {
+    return static_cast<uint32_t>(p[0]) << 24 | p[1] << 16 | p[2] << 8 | p[3];
+}
+
+static uint16_t loadBig16(const uint8_t* p) {
+    return static_cast<uint16_t>(p[0] << 8 | p[1]);
+}
+
+static void storeBig32(uint8_t* p, uint32_t value) {
+    p[0] = static_cast<uint8_t>(value >> 24);
+    p[1] = static_cast<uint8_t>(value >> 16);
+    p[2] = static_cast<uint8_t>(value >> 8);
+    p[3] = static_cast<uint8_t>(value);
+}
+
+static void storeBig16(uint8_t* p, uint16_t value) {
+    p[0] = static_cast<uint8_t>(value >> 8);
+    p[1] = static_cast<uint8_t>(value);
+}
+
+static sockaddr_un socketAddress(const std::string& socketPath) {
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    if (socketPath.size() >= sizeof address.sun_path)
+        throw std::runtime_error("Socket path too long: " + socketPath);
+    std::memcpy(address.sun_path, socketPath.c_str(), socketPath.size() + 1);
+    return address;
+}
+
+#if defined(__linux__)
+
+// Bytes read from a client per call.
+static constexpr size_t ReadBlock = 1 << 16;
+
+// Bytes read from a client per readiness event, so a fast writer cannot push
+// an unbounded amount of input through in one go. The rest stays queued in
+// the socket and wakes the loop again.
+static constexpr size_t ReadLimit = 4 * ReadBlock;
+
+// A client whose unsent responses exceed this is neither read from nor
+// answered until they drain, so a client that pipelines without reading
+// cannot grow the server. Sent responses are also dropped from the front of
+// the buffer once they pass it, which bounds a slow but steady reader.
+static constexpr size_t OutputHighWater = 4 << 20;
+
+namespace {
+
+struct Connection {
+    int fd;
+    std::vector<uint8_t> input;
+    size_t inputStart = 0;
+    std::vector<uint8_t> output;
+    size_t outputStart = 0;
+    uint32_t events = 0;
+    // The client has shut down its side; only the remaining responses go out.
+    bool peerClosed = false;
+
+    size_t pendingOutput() const { return output.size() - outputStart; }
+
+    // Whether to take more input: not while responses are backed up, nor
+    // while requests held back behind them fill ReadLimit.
+    bool wantsInput() const {
+        return !peerClosed && pendingOutput() < OutputHighWater && input.size() - inputStart < ReadLimit;
+    }
+};
+
+// Closes fd when the scope it guards is left.
+struct FileDescriptor {
+    int fd;
+    ~FileDescriptor() {
+        if (fd >= 0) ::close(fd);
+    }
+};
+
+}
+
+// Answers one request frame, appending the response to output. Returns false
+// when the request is malformed.
+static bool answerRequest(const uint8_t* request, size_t length, std::vector<uint8_t>& output) {
+    if (length < DecodeRequestHeader) return false;
+    const uint8_t isaValue = request[0];
+    const size_t count = loadBig16(request + 2);
+    if (isaValue >= IsaCount || request[1] != 0 || length != DecodeRequestHeader + count * 2) return false;
+    const auto isa = static_cast<ISA>(isaValue);
+
+    std::array<uint16_t, 4096> words;
+    std::array<DecodedInsn, 4096> decoded;
+
+    const size_t frameStart = output.size();
+    output.resize(frameStart + DecodeFrameHeader + 2 + count * (1 + MaxInsnText));
+    uint8_t* cursor = output.data() + frameStart + DecodeFrameHeader;
+    storeBig16(cursor, static_cast<uint16_t>(count));
+    cursor += 2;
+
+    for (size_t start = 0; start < count; start += words.size()) {
+        const size_t block = std::min(words.size(), count - start);
+        for (size_t i = 0; i < block; ++i) words[i] = loadBig16(request + DecodeRequestHeader + (start + i) * 2);
+        decodeBatch({words.data(), block}, isa, decoded);
+
+        for (size_t i = 0; i < block; ++i) {
+            const size_t textLength = format(decoded[i], isa, reinterpret_cast<char*>(cursor + 1));
+            *cursor = static_cast<uint8_t>(textLength);
+            cursor += 1 + textLength;
+        }
+    }
+
+    const size_t frameLength = static_cast<size_t>(cursor - output.data()) - frameStart;
+    storeBig32(output.data() + frameStart, static_cast<uint32_t>(frameLength - DecodeFrameHeader));
+    output.resize(frameStart + frameLength);
+    return true;
+}
+
+// Answers the complete requests buffered for connection until its unsent
+// responses reach OutputHighWater. Returns false when one is malformed.
+static bool answerRequests(Connection& connection) {
+    auto& input = connection.input;
+    while (input.size() - connection.inputStart >= DecodeFrameHeader && connection.pendingOutput() < OutputHighWater) {
+        const uint8_t* frame = input.data() + connection.inputStart;
+        const size_t length = loadBig32(frame);
+        if (length > DecodeRequestHeader + MaxRequestWords * 2) return false;
+        if (input.size() - connection.inputStart < DecodeFrameHeader + length) break;
+
+        if (!answerRequest(frame + DecodeFrameHeader, length, connection.output)) return false;
+        connection.inputStart += DecodeFrameHeader + length;
+    }
+
+    input.erase(input.begin(), input.begin() + static_cast<std::ptrdiff_t>(connection.inputStart));
+    connection.inputStart = 0;
+    return true;
+}
+
+// Sends what the socket takes without blocking. Returns false when the
+// client has gone away.
+static bool sendPending(Connection& connection) {
+    while (connection.pendingOutput() > 0) {
+        const ssize_t sent = ::send(connection.fd, connection.output.data() + connection.outputStart,
+                                    connection.pendingOutput(), MSG_NOSIGNAL);
+        if (sent < 0) {
+            if (errno == EINTR) continue;
+            if (errno != EAGAIN && errno != EWOULDBLOCK) return false;
+            break;
+        }
+        connection.outputStart += static_cast<size_t>(sent);
+    }
+    if (connection.pendingOutput() == 0) {
+        connection.output.clear();
+        connection.outputStart = 0;
+    } else if (connection.outputStart >= OutputHighWater) {
+        auto& output = connection.output;
+        output.erase(output.begin(), output.begin() + static_cast<std::ptrdiff_t>(connection.outputStart));
+        connection.outputStart = 0;
+    }
+    return true;
+}
+
+// Reads what the socket has without blocking, up to ReadLimit bytes. Returns
+// false on end of stream or error.
+static bool receivePending(Connection& connection) {
+    for (size_t total = 0; total < ReadLimit;) {
+        const size_t size = connection.input.size();
+        connection.input.resize(size + ReadBlock);
+        const ssize_t received = ::recv(connection.fd, connection.input.data() + size, ReadBlock, 0);
+        connection.input.resize(size + static_cast<size_t>(std::max<ssize_t>(received, 0)));
+        if (received > 0) {
+            if (static_cast<size_t>(received) < ReadBlock) return true;
+            total += static_cast<size_t>(received);
+            continue;
+        }
+        if (received == 0) return false;
+        if (errno == EINTR) continue;
+        return errno == EAGAIN || errno == EWOULDBLOCK;
+    }
+    return true;
+}
+
+// Answers and sends until the socket takes no more or nothing is left to
+// answer. Requests held back by OutputHighWater are answered as soon as the
+// responses before them are sent. Returns false when the connection is done
+// for.
+static bool serveConnection(Connection& connection) {
+    for (;;) {
+        if (!answerRequests(connection)) return false;
+        const bool heldBack = connection.pendingOutput() >= OutputHighWater;
+        if (!sendPending(connection)) return false;
+        if (!heldBack || connection.pendingOutput() > 0) return true;
+    }
+}
+
+static void updateInterest(int epoll, Connection& connection) {
+    uint32_t events = 0;
+    if (connection.wantsInput()) events |= EPOLLIN;
+    if (connection.pendingOutput() > 0) events |= EPOLLOUT;
+    if (events == connection.events) return;
+
+    epoll_event event{};
+    event.events = events;
+    event.data.fd = connection.fd;
+    ::epoll_ctl(epoll, EPOLL_CTL_MOD, connection.fd, &event);
+    connection.events = events;
+}
+
+void runDecodeServer(const std::string& socketPath) {
+    const sockaddr_un address = socketAddress(socketPath);
+
+    sigset_t stopSignals;
+    sigemptyset(&stopSignals);
+    sigaddset(&stopSignals, SIGINT);
+    sigaddset(&stopSignals, SIGTERM);
+    if (::sigprocmask(SIG_BLOCK, &stopSignals, nullptr) != 0) throw systemError("Failed to block signals");
+    const FileDescriptor signals{::signalfd(-1, &stopSignals, SFD_CLOEXEC)};
+    if (signals.fd < 0) throw systemError("Failed to create signalfd");
+
+    const FileDescriptor listener{::socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0)};
+    if (listener.fd < 0) throw systemError("Failed to create socket");
+    ::unlink(socketPath.c_str());
+    if (::bind(listener.fd, reinterpret_cast<const sockaddr*>(&address), sizeof address) != 0)
+        throw systemError("Failed to bind " + socketPath);
+    if (::listen(listener.fd, SOMAXCONN) != 0) throw systemError("Failed to listen on " + socketPath);
+
+    const FileDescriptor epoll{::epoll_create1(EPOLL_CLOEXEC)};
+    if (epoll.fd < 0) throw systemError("Failed to create epoll instance");
+    for (const int fd : {listener.fd, signals.fd}) {
+        epoll_event event{};
+        event.events = EPOLLIN;
+        event.data.fd = fd;
+        if (::epoll_ctl(epoll.fd, EPOLL_CTL_ADD, fd, &event) != 0) throw systemError("Failed to watch descriptor");
+    }
+
+    std::unordered_map<int, std::unique_ptr<Connection>> connections;
+    const auto close = [&](Connection& connection) {
+        ::epoll_ctl(epoll.fd, EPOLL_CTL_DEL, connection.fd, nullptr);
+        ::close(connection.fd);
+        connections.erase(connection.fd);
+    };
+
+    std::array<epoll_event, 64> events;
+    for (bool running = true; running;) {
+        const int ready = ::epoll_wait(epoll.fd, events.data(), static_cast<int>(events.size()), -1);
+        if (ready < 0) {
+            if (errno == EINTR) continue;
+            throw systemError("Failed to wait for clients");
+        }
+
+        for (int i = 0; i < ready; ++i) {
+            const int fd = events[i].data.fd;
+            if (fd == signals.fd) {
+                // Consumed here so it is not delivered once unblocked below.
+                signalfd_siginfo info;
+                [[maybe_unused]] const ssize_t consumed = ::read(signals.fd, &info, sizeof info);
+                running = false;
+                continue;
+            }
+
+            if (fd == listener.fd) {
+                for (;;) {
+                    const int client = ::accept4(listener.fd, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+                    if (client < 0) break;
+
+                    auto connection = std::make_unique<Connection>();
+                    connection->fd = client;
+                    connection->events = EPOLLIN;
+                    epoll_event event{};
+                    event.events = EPOLLIN;
+                    event.data.fd = client;
+                    if (::epoll_ctl(epoll.fd, EPOLL_CTL_ADD, client, &event) != 0) {
+                        ::close(client);
+                        continue;
+                    }
+                    connections.emplace(client, std::move(connection));
+                }
+                continue;
+            }
+
+            const auto found = connections.find(fd);
+            if (found == connections.end()) continue;
+            Connection& connection = *found->second;
+
+            if ((events[i].events & (EPOLLIN | EPOLLHUP | EPOLLERR)) && connection.wantsInput())
+                connection.peerClosed = !receivePending(connection);
+            bool open = serveConnection(connection);
+            if (connection.peerClosed && connection.pendingOutput() == 0) open = false;
+
+            if (!open) {
+                close(connection);
+                continue;
+            }
+            updateInterest(epoll.fd, connection);
+        }
+    }
+
+    for (auto& [fd, connection] : connections) ::close(fd);
+    ::unlink(socketPath.c_str());
+    ::sigprocmask(SIG_UNBLOCK, &stopSignals, nullptr);
+}
+
+#else
+
+void runDecodeServer(const std::string&) {
+    throw std::runtime_error("The decode daemon needs epoll and is only available on Linux");
+}
+
+#endif
+
+DecodeClient::DecodeClient(const std::string& socketPath) {
+    const sockaddr_un address = socketAddress(socketPath);
+    fd_ = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (fd_ < 0) throw systemError("Failed to create socket");
+    if (::connect(fd_, reinterpret_cast<const sockaddr*>(&address), sizeof address) != 0) {
+        const std::runtime_error error = systemError("Failed to connect to " + socketPath);
+        ::close(fd_);
+        throw error;
+    }
+}
+
+DecodeClient::~DecodeClient() {
+    ::close(fd_);
+}
+
+std::vector<std::string> DecodeClient::decode(std::span<const uint16_t> words, const ISA isa) {
+    std::vector<std::string> texts;
+    texts.reserve(words.size());
+
+    std::vector<uint8_t> frame;
+    while (!words.empty()) {
+        const size_t count = std::min(words.size(), MaxRequestWords);
+        frame.resize(DecodeFrameHeader + DecodeRequestHeader + count * 2);
+        storeBig32(frame.data(), static_cast<uint32_t>(DecodeRequestHeader + count * 2));
+        frame[4] = static_cast<uint8_t>(isa);
+        frame[5] = 0;
+        storeBig16(frame.data() + 6, static_cast<uint16_t>(count));
+        for (size_t i = 0; i < count; ++i) storeBig16(frame.data() + 8 + i * 2, words[i]);
+        sendAll(frame.data(), frame.size());
+
+        uint8_t header[DecodeFrameHeader + 2];
+        receiveAll(header, sizeof header);
+        const size_t length = loadBig32(header);
+        if (length < 2 || loadBig16(header + 4) != count) throw std::runtime_error("Malformed response from decode daemon");
+
+        frame.resize(length - 2);
+        receiveAll(frame.data(), frame.size());
+        for (size_t position = 0, i = 0; i < count; ++i) {
+            if (position >= frame.size() || frame[position] > frame.size() - position - 1)
+                throw std::runtime_error("Malformed response from decode daemon");
+            texts.emplace_back(reinterpret_cast<const char*>(frame.data() + position + 1), frame[position]);
+            position += 1 + frame[position];
+        }
+        words = words.subspan(count);
+    }
+    return texts;
+}
+
+void DecodeClient::sendAll(const uint8_t* data, size_t length) {
+    while (length > 0) {
+        const ssize_t sent = ::send(fd_, data, length, MSG_NOSIGNAL);
+        if (sent < 0) {
+            if (errno == EINTR) continue;
+            throw systemError("Failed to send to decode daemon");
+        }
+        data += sent;
+        length -= static_cast<size_t>(sent);
+    }
+}
+
+void DecodeClient::receiveAll(uint8_t* data, size_t length) {
+    while (length > 0) {
+        const ssize_t received = ::recv(fd_, data, length, 0);
+        if (received == 0) throw std::runtime_error("Decode daemon closed the connection");
+        if (received < 0) {
+            if (errno == EINTR) continue;
+            throw systemError("Failed to receive from decode daemon");
+        }
+        data += received;
+        length -= static_cast<size_t>(received);
+    }
+}
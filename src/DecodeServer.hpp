@@ -0,0 +1,59 @@
+/*
+ * This code is licensed under the GNU AGPLv3
+ * Copyright (c) 2025 GokbakarE
+ * Date: 28-08-2025
+ */
+
+#pragma once
+#ifndef DECODESERVER_H
+#define DECODESERVER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "SuperH.hpp"
+
+// Wire protocol of the decode daemon. All integers are big-endian, and every
+// frame starts with a u32 giving the number of bytes that follow it.
+//
+//   request:  u32 length | u8 isa | u8 reserved (0) | u16 count | count x u16 word
+//   response: u32 length | u16 count | count x (u8 length | text)
+//
+// isa is the ISA enumerator value. A connection may pipeline any number of
+// requests; responses come back in request order. A malformed request closes
+// the connection.
+inline constexpr size_t DecodeFrameHeader = 4;
+inline constexpr size_t DecodeRequestHeader = 4;
+inline constexpr size_t MaxRequestWords = 0xFFFF;
+
+// Serves decode requests on a Unix domain socket at socketPath, replacing a
+// stale socket file, until SIGINT or SIGTERM arrives; the socket file is
+// removed on the way out. Clients are multiplexed with epoll, so one thread
+// serves any number of them. Throws std::runtime_error when the socket cannot
+// be set up.
+void runDecodeServer(const std::string& socketPath);
+
+// Blocking client for the decode daemon.
+class DecodeClient {
+public:
+    explicit DecodeClient(const std::string& socketPath);
+    ~DecodeClient();
+
+    DecodeClient(const DecodeClient&) = delete;
+    DecodeClient& operator=(const DecodeClient&) = delete;
+
+    // Decodes words on the server, MaxRequestWords per round trip. Throws
+    // std::runtime_error when the connection fails.
+    std::vector<std::string> decode(std::span<const uint16_t> words, ISA isa);
+
+private:
+    void sendAll(const uint8_t* data, size_t length);
+    void receiveAll(uint8_t* data, size_t length);
+
+    int fd_ = -1;
+};
+
+#endif
@@ -0,0 +1,144 @@
+/*
+ * This code is licensed under the GNU AGPLv3
+ * Copyright (c) 2025 GokbakarE
+ * Date: 28-08-2025
+ */
+
+#pragma once
+#ifndef DECODETABLE_H
+#define DECODETABLE_H
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+// One row of the instruction table. isas is a bitmask of the ISAs the row
+// belongs to, bit i standing for the ISA enumerator with value i.
+struct OpcodeEntry {
+    std::string_view pattern;
+    std::string_view assembly;
+    uint8_t isas;
+};
+
+// An instruction pattern compiled to fixed-bit form: a word matches when
+// (word & mask) == value. specificity is the number of fixed bits.
+struct OpcodePattern {
+    uint16_t mask;
+    uint16_t value;
+    uint8_t specificity;
+    uint16_t opcode;
+};
+
+// Flat index from a raw 16-bit encoding to its row in the instruction table.
+using DecodeTable = std::array<uint16_t, 65536>;
+
+inline constexpr uint16_t NoOpcode = 0xFFFF;
+
+constexpr OpcodePattern compilePattern(std::string_view pattern, uint16_t opcode) {
+    OpcodePattern compiled{0, 0, 0, opcode};
+    for (char c : pattern) {
+        compiled.mask = static_cast<uint16_t>(compiled.mask << 1);
+        compiled.value = static_cast<uint16_t>(compiled.value << 1);
+        if (c == '0' || c == '1') {
+            compiled.mask |= 1;
+            compiled.value |= (c == '1');
+            ++compiled.specificity;
+        }
+    }
+    return compiled;
+}
+
+template <size_t N>
+struct CompiledPatterns {
+    std::array<OpcodePattern, N> patterns;
+    size_t count;
+};
+
+// Compiles the rows of an instruction table that belong to isaMask into
+// (mask, value, specificity) triples ordered most-specific-first, so the
+// first pattern that matches a word is the one that decodes it. Every pattern
+// character other than '0' and '1' is an operand field. Two patterns that can
+// match the same word are only allowed when one strictly refines the other;
+// anything else fails to compile.
+template <size_t N>
+consteval CompiledPatterns<N> compilePatterns(const OpcodeEntry (&entries)[N], uint8_t isaMask) {
+    static_assert(N < NoOpcode, "Instruction table too large for a 16-bit index");
+
+    CompiledPatterns<N> compiled{};
+    for (size_t i = 0; i < N; ++i) {
+        if (entries[i].pattern.size() != 16) throw "Instruction pattern must be 16 characters";
+        if (!(entries[i].isas & isaMask)) continue;
+        compiled.patterns[compiled.count++] = compilePattern(entries[i].pattern, static_cast<uint16_t>(i));
+    }
+
+    for (size_t i = 0; i < compiled.count; ++i) {
+        for (size_t j = i + 1; j < compiled.count; ++j) {
+            const OpcodePattern& a = compiled.patterns[i];
+            const OpcodePattern& b = compiled.patterns[j];
+            if ((a.value ^ b.value) & a.mask & b.mask) continue;
+
+            const uint16_t common = a.mask & b.mask;
+            if (a.mask == b.mask) throw "ISA has two instructions for the same encoding";
+            if (common != a.mask && common != b.mask) throw "ISA has partially overlapping patterns";
+        }
+    }
+
+    std::sort(compiled.patterns.begin(), compiled.patterns.begin() + compiled.count,
+              [](const OpcodePattern& a, const OpcodePattern& b) {
+                  if (a.specificity != b.specificity) return a.specificity > b.specificity;
+                  return a.opcode < b.opcode;
+              });
+    return compiled;
+}
+
+// Expands compiled patterns into a DecodeTable. Patterns are visited
+// most-specific-first and never overwrite a slot that is already taken.
+template <size_t N>
+consteval DecodeTable buildDecodeTable(const CompiledPatterns<N>& compiled) {
+    DecodeTable table{};
+    for (auto& slot : table) slot = NoOpcode;
+
+    for (size_t i = 0; i < compiled.count; ++i) {
+        const OpcodePattern& pattern = compiled.patterns[i];
+        const uint16_t fieldBits = static_cast<uint16_t>(~pattern.mask);
+        for (uint16_t bits = fieldBits;; bits = (bits - 1) & fieldBits) {
+            uint16_t& slot = table[pattern.value | bits];
+            if (slot == NoOpcode) slot = pattern.opcode;
+            if (bits == 0) break;
+        }
+    }
+    return table;
+}
+
+// Parses a 16-character "0101..." string into its raw encoding.
+constexpr std::optional<uint16_t> binaryToWord(std::string_view binaryCode) {
+    if (binaryCode.size() != 16) return std::nullopt;
+
+    uint16_t word = 0;
+    for (char c : binaryCode) {
+        if (c != '0' && c != '1') return std::nullopt;
+        word = static_cast<uint16_t>((word << 1) | (c == '1'));
+    }
+    return word;
+}
+
+// Parses a 4-digit hex halfword such as "c3c3" into its raw encoding.
+constexpr std::optional<uint16_t> hexToWord(std::string_view hex4) {
+    if (hex4.size() != 4) return std::nullopt;
+
+    uint16_t word = 0;
+    for (char c : hex4) {
+        int digit;
+        if (c >= '0' && c <= '9') digit = c - '0';
+        else if (c >= 'a' && c <= 'f') digit = c - 'a' + 10;
+        else if (c >= 'A' && c <= 'F') digit = c - 'A' + 10;
+        else return std::nullopt;
+        word = static_cast<uint16_t>((word << 4) | digit);
+    }
+    return word;
+}
+
+#endif
@@ -4,167 +4,450 @@
  * Date: 28-08-2025
  */
 
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
 #include <iostream>
 #include <string>
 #include <string_view>
 #include <cstdlib>
 #include <vector>
 #include <stdexcept>
-#include <fstream>
-#include <sstream>
-#include <algorithm>
+#include <thread>
 #include <optional>
-#include <cctype>
 
-#include "SuperH1.hpp"
-#include "SuperH2.hpp"
-#include "SuperH3DSP.hpp"
-#include "SuperH3E.hpp"
-#include "SuperH3.hpp"
-#include "SuperH4A.hpp"
-#include "SuperH4.hpp"
-#include "SuperHDSP.hpp"
+#include <unistd.h>
+
+#include "Batch.hpp"
+#include "DecodeServer.hpp"
+#include "ElfFile.hpp"
+#include "Histogram.hpp"
+#include "Listing.hpp"
+#include "MappedFile.hpp"
+#include "OutputWriter.hpp"
+#include "RenderTable.hpp"
+#include "Stats.hpp"
+#include "SuperH.hpp"
+#include "Trace.hpp"
+#include "WordStream.hpp"
 
 void printUsage(const char* progName) {
     std::cout << "Usage:\n"
               << "  " << progName << " --SuperH* <binarystring>\n"
-              << "  " << progName << " --file <filename> [section] [--SuperH*] [--number <N>]\n\n"
+              << "  " << progName << " --file <filename> [section] [listing options]\n"
+              << "  " << progName << " --raw <filename|-> [--offset <N>] [--length <N>] [--base <addr>] [listing options]\n"
+              << "  " << progName << " --stdin [--SuperH*] [--format <F>] [--endian <E>] [--flush <P>]\n"
+              << "  " << progName << " --write-render-table <file>\n"
+              << "  " << progName << " --daemon <socket>\n"
+              << "  " << progName << " --client <socket> [--SuperH*] <binarystring>...\n"
+              << "  " << progName << " --batch <listfile|directory> [section] [--output-dir <dir>] [listing options]\n\n"
+              << "Listing options:\n"
+              << "  [--SuperH*] [--endian <E>] [--number <N>] [--writer <W>] [--jobs <N>]\n"
+              << "  [--render-table <file>] [--stats] [--perf] [--trace <file>] [--histogram <F>]\n\n"
               << "Options:\n"
               << "  --SuperH*      Choose the target ISA architecture. Supported:\n"
               << "                 --SuperH1, --SuperH2, --SuperH3, --SuperH3E,\n"
               << "                 --SuperH3DSP, --SuperH4, --SuperH4A, --SuperHDSP\n"
               << "  <binarystring> A 16-bit binary instruction string (e.g., 1100001111000011)\n"
-              << "  <filename>     ELF file or binary to analyze with objdump\n"
+              << "  <filename>     32-bit ELF file to analyze\n"
               << "  [section]      Optional section to filter (e.g., .text)\n"
-              << "  --number <N>   Optional limit on number of instructions to decode (default: 50)\n\n"
+              << "  --number <N>   Optional limit on number of instructions to decode, or all\n"
+              << "                 (default: 50). Input is streamed, so memory use does not\n"
+              << "                 grow with the size of the file.\n"
+              << "  --endian <E>   Instruction byte order, big or little. ELF files default\n"
+              << "                 to the order in their header, raw images to big.\n"
+              << "  --writer <W>   How the listing is written: write (large write(2) calls),\n"
+              << "                 splice (vmsplice(2) into a pipe), stream (std::cout) or\n"
+              << "                 auto, which splices when stdout is a pipe (default)\n"
+              << "  --jobs <N>     Decode with N threads, 0 for one per CPU (default: 1). The\n"
+              << "                 output is identical to a single-threaded run. Chunks\n"
+              << "                 waiting to be written take at most about 36 MB for any N.\n"
+              << "  --stats        Report bytes read, instructions, word fallbacks, the time\n"
+              << "                 spent loading, decoding, formatting and writing, and\n"
+              << "                 instructions per second on stderr at exit\n"
+              << "  --perf         --stats plus hardware counters per stage: cycles,\n"
+              << "                 instructions, IPC, and branch, L1d and LLC misses per\n"
+              << "                 decoded instruction. Falls back to wall-clock only when\n"
+              << "                 the kernel denies perf_event_open(2).\n"
+              << "  --trace <file> Record a timeline of every pipeline stage per thread and\n"
+              << "                 write it to file for chrome://tracing or Perfetto\n"
+              << "  --histogram <F>\n"
+              << "                 Count opcodes, instruction classes and registers per\n"
+              << "                 section instead of listing, and print them sorted as a\n"
+              << "                 table or json. Counts every instruction unless --number\n"
+              << "                 is given. Not valid with --batch.\n"
+              << "  --batch        List many ELF files in one run: every ELF file below a\n"
+              << "                 directory, or the files named one per line in a list\n"
+              << "                 file. Each listing goes to <input>.DisSH, and --jobs\n"
+              << "                 defaults to one thread per CPU.\n"
+              << "  --output-dir <dir>\n"
+              << "                 Batch mode: write the listings below dir instead of\n"
+              << "                 next to each input\n"
+              << "  --stdin        Decode a stream of words from standard input, one line\n"
+              << "                 per word, until end of input\n"
+              << "  --format <F>   Stdin mode: binary (16-character strings, default), hex\n"
+              << "                 (4-digit halfwords) or raw (bare bytes)\n"
+              << "  --flush <P>    Stdin mode: flush after every line, when idle, i.e. all\n"
+              << "                 input so far is answered (default), or when full\n"
+              << "  --render-table <file>\n"
+              << "                 Render listings from a precomputed table mapped from file\n"
+              << "  --write-render-table <file>\n"
+              << "                 Write the precomputed render table of every word in\n"
+              << "                 every ISA to file\n"
+              << "  --daemon       Serve decode requests on a Unix domain socket until\n"
+              << "                 SIGINT or SIGTERM, keeping the process and its tables warm\n"
+              << "  --client       Decode the given words through a running daemon\n"
+              << "  --raw          Treat <filename> as a raw code image instead of ELF; - reads\n"
+              << "                 the image from standard input\n"
+              << "  --offset <N>   Raw mode: file offset to start decoding at (default: 0)\n"
+              << "  --length <N>   Raw mode: number of bytes to decode (default: to end of file)\n"
+              << "  --base <addr>  Raw mode: load address of the file's first byte (default: 0)\n"
+              << "                 Numbers may be given in decimal or as 0x-prefixed hex.\n\n"
               << "Examples:\n"
               << "  " << progName << " --SuperH4 1100001111000011\n"
               << "  " << progName << " --file program.elf .text --SuperH1 --number 122\n"
+              << "  " << progName << " --raw flash.bin --offset 0x10000 --length 0x4000 --base 0xa0000000\n"
+              << "  " << progName << " --raw - --endian little --number all < nand.bin\n"
               << "  " << progName << " --help\n";
 }
 
-bool isHexChar(char c) {
-    return std::isxdigit(static_cast<unsigned char>(c));
-}
+// Parses a decimal or 0x-prefixed hexadecimal number.
+std::optional<uint64_t> parseNumber(std::string_view text) {
+    int base = 10;
+    if (text.size() > 2 && text[0] == '0' && (text[1] == 'x' || text[1] == 'X')) {
+        text.remove_prefix(2);
+        base = 16;
+    }
 
-unsigned char hexPairToByte(char high, char low) {
-    auto hexVal = [](char c) -> int {
-        if (c >= '0' && c <= '9') return c - '0';
-        if (c >= 'a' && c <= 'f') return c - 'a' + 10;
-        if (c >= 'A' && c <= 'F') return c - 'A' + 10;
-        throw std::runtime_error("Invalid hex digit");
-    };
-    return (hexVal(high) << 4) | hexVal(low);
+    uint64_t value = 0;
+    const auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), value, base);
+    if (error != std::errc() || end != text.data() + text.size() || text.empty()) return std::nullopt;
+    return value;
 }
 
-bool processDisSHFile(const std::string& disshFilename, const std::optional<std::string>& section = std::nullopt) {
-    std::ifstream file(disshFilename);
-    if (!file) {
-        std::cerr << "Failed to open file: " << disshFilename << "\n";
-        return false;
-    }
+enum class InputKind { Elf, Raw, Batch };
+
+struct FileOptions {
+    std::string filename;
+    std::optional<std::string> section;
+    ListingOptions listing;
+    // Byte order given on the command line, overriding the file's own.
+    std::optional<Endian> endian;
+    uint64_t offset = 0;
+    std::optional<uint64_t> length;
+    uint64_t base = 0;
+    OutputMode output = OutputMode::Auto;
+    std::optional<std::string> outputDir;
+    std::optional<std::string> renderTable;
+    bool stats = false;
+    // Also sample hardware counters; implies stats.
+    bool perf = false;
+    std::optional<std::string> trace;
+    std::optional<HistogramFormat> histogram;
+};
+
+// Parses the arguments following "--file <filename>", "--raw <filename>" or
+// "--batch <source>". Reports the problem and returns false on a bad argument.
+bool parseFileOptions(int argc, char* argv[], InputKind kind, FileOptions& options) {
+    options.filename = argv[2];
+    const bool raw = kind == InputKind::Raw;
+    // A batch spreads its files over every CPU unless told otherwise.
+    if (kind == InputKind::Batch) options.listing.jobs = 0;
+    bool numberGiven = false;
+
+    for (int i = 3; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg.rfind("--SuperH", 0) == 0) {
+            const auto flagIsa = isaFromFlag(arg);
+            if (!flagIsa) {
+                std::cerr << "Unknown ISA flag: " << arg << "\n";
+                return false;
+            }
+            options.listing.isa = *flagIsa;
+            continue;
+        }
+        if (arg == "--stats" || arg == "--perf") {
+            options.stats = true;
+            options.perf = options.perf || arg == "--perf";
+            continue;
+        }
 
-    std::vector<std::string> lines;
-    std::string line;
-    while (std::getline(file, line)) lines.push_back(line);
-    file.close();
-
-    auto split = [](const std::string& str) {
-        std::istringstream iss(str);
-        std::vector<std::string> tokens;
-        std::string token;
-        while (iss >> token) tokens.push_back(token);
-        return tokens;
-    };
-
-    auto containsDot = [](const std::string& w) {
-        return w.find('.') != std::string::npos;
-    };
-
-    if (section) {
-        std::string sectionHeader = "Contents of section " + *section + ":";
-        int start = -1;
-        for (size_t i = 0; i < lines.size(); ++i)
-            if (lines[i].find(sectionHeader) != std::string::npos)
-                start = static_cast<int>(i);
-
-        if (start == -1) {
-            std::cerr << "Section not found: " << *section << "\n";
+        const bool rawOnly = arg == "--offset" || arg == "--length" || arg == "--base";
+        const bool batchOnly = arg == "--output-dir";
+        const bool listingOption = arg == "--number" || arg == "--endian" || arg == "--writer" || arg == "--jobs" ||
+                                   arg == "--render-table" || arg == "--trace" || arg == "--histogram";
+        if (!listingOption && !rawOnly && !batchOnly) {
+            if (raw || options.section) {
+                std::cerr << "Unknown option: " << arg << "\n";
+                return false;
+            }
+            options.section = arg;
+            continue;
+        }
+        if (rawOnly && !raw) {
+            std::cerr << arg << " is only valid with --raw.\n";
             return false;
         }
+        if (batchOnly && kind != InputKind::Batch) {
+            std::cerr << arg << " is only valid with --batch.\n";
+            return false;
+        }
+        if (i + 1 >= argc) {
+            std::cerr << arg << " requires a value.\n";
+            return false;
+        }
+        const std::string value = argv[++i];
+        numberGiven = numberGiven || arg == "--number";
+
+        if (arg == "--endian") {
+            options.endian = endianFromName(value);
+            if (!options.endian) {
+                std::cerr << "--endian requires big or little.\n";
+                return false;
+            }
+            continue;
+        }
+        if (arg == "--output-dir") {
+            options.outputDir = value;
+            continue;
+        }
+        if (arg == "--render-table") {
+            options.renderTable = value;
+            continue;
+        }
+        if (arg == "--trace") {
+            options.trace = value;
+            continue;
+        }
+        if (arg == "--histogram") {
+            if (kind == InputKind::Batch) {
+                std::cerr << "--histogram is not valid with --batch.\n";
+                return false;
+            }
+            options.histogram = histogramFormatFromName(value);
+            if (!options.histogram) {
+                std::cerr << "--histogram requires table or json.\n";
+                return false;
+            }
+            continue;
+        }
+        if (arg == "--writer") {
+            const auto mode = outputModeFromName(value);
+            if (!mode) {
+                std::cerr << "--writer requires auto, write, splice or stream.\n";
+                return false;
+            }
+            options.output = *mode;
+            continue;
+        }
+        if (arg == "--number" && value == "all") {
+            options.listing.limit = SIZE_MAX;
+            continue;
+        }
 
-        int end = static_cast<int>(lines.size());
-        for (size_t i = start + 1; i < lines.size(); ++i)
-            if (lines[i].find("Contents") != std::string::npos) {
-                end = static_cast<int>(i);
-                break;
+        const auto number = parseNumber(value);
+        if (!number) {
+            std::cerr << "Invalid value for " << arg << ": " << value << "\n";
+            return false;
+        }
+        if (arg == "--number") options.listing.limit = static_cast<size_t>(*number);
+        else if (arg == "--jobs") options.listing.jobs = static_cast<unsigned>(*number);
+        else if (arg == "--offset") options.offset = *number;
+        else if (arg == "--length") options.length = *number;
+        else options.base = *number;
+    }
+    if (options.listing.jobs == 0) options.listing.jobs = std::max(1u, std::thread::hardware_concurrency());
+    // A histogram is only useful over the whole input.
+    if (options.histogram && !numberGiven) options.listing.limit = SIZE_MAX;
+    return true;
+}
+
+OutputWriter makeWriter(OutputMode mode) {
+    if (mode == OutputMode::Stream) return OutputWriter(std::cout);
+    return OutputWriter(STDOUT_FILENO, mode);
+}
+
+int processElfFile(FileOptions& options) {
+    Tracer* const tracer = options.listing.tracer;
+    try {
+        std::optional<ElfFile> loaded;
+        {
+            const TraceSpan span(tracer, "load file");
+            loaded.emplace(options.filename);
+        }
+        const ElfFile& elf = *loaded;
+        OutputWriter out = makeWriter(options.output);
+        out.trackStats(options.listing.stats);
+        out.traceFlushes(tracer);
+
+        std::vector<const ElfSection*> selected;
+        {
+            const TraceSpan span(tracer, "section lookup");
+            if (options.section) {
+                const ElfSection* found = elf.findSection(*options.section);
+                if (!found) {
+                    std::cerr << "Section not found: " << *options.section << "\n";
+                    return 1;
+                }
+                selected.push_back(found);
+            } else {
+                selected = elf.codeSections();
             }
+        }
+
+        options.listing.endian = options.endian.value_or(elf.bigEndian() ? Endian::Big : Endian::Little);
+        printListing(elf, selected, options.listing, out);
+        out.flush();
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << "\n";
+        return 1;
+    }
 
-        lines = std::vector<std::string>(lines.begin() + start, lines.begin() + end);
-        if (!lines.empty()) lines.erase(lines.begin());
-    } else {
-        if (lines.size() > 2)
-            lines.erase(lines.begin(), lines.begin() + 2);
+    return 0;
+}
+
+int processBatch(FileOptions& options) {
+    BatchOptions batch;
+    batch.listing = options.listing;
+    batch.endian = options.endian;
+    batch.section = options.section;
+    if (options.outputDir) batch.outputDir = *options.outputDir;
+    batch.threads = options.listing.jobs;
+
+    try {
+        const std::vector<BatchInput> inputs = batchInputs(options.filename);
+        return runBatch(inputs, batch, std::cerr) == 0 ? 0 : 1;
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << "\n";
+        return 1;
     }
+}
 
-    std::vector<std::string> cleaned;
-    for (const auto& l : lines) {
-        if (l.find("Contents") != std::string::npos) continue;
-        auto words = split(l);
-        if (words.size() <= 2) continue;
+int processStdin(int argc, char* argv[]) {
+    WordStreamOptions options;
 
-        std::vector<std::string> mid(words.begin() + 1, words.end() - 1);
-        if (mid.size() > 4) mid.erase(mid.begin() + 4);
-        mid.erase(std::remove_if(mid.begin(), mid.end(), containsDot), mid.end());
+    for (int i = 2; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg.rfind("--SuperH", 0) == 0) {
+            const auto flagIsa = isaFromFlag(arg);
+            if (!flagIsa) {
+                std::cerr << "Unknown ISA flag: " << arg << "\n";
+                return 1;
+            }
+            options.isa = *flagIsa;
+            continue;
+        }
+        if (arg != "--format" && arg != "--endian" && arg != "--flush") {
+            std::cerr << "Unknown option: " << arg << "\n";
+            return 1;
+        }
+        if (i + 1 >= argc) {
+            std::cerr << arg << " requires a value.\n";
+            return 1;
+        }
 
-        std::string joined;
-        for (auto& w : mid) joined += w;
-        cleaned.push_back(joined);
+        const std::string value = argv[++i];
+        bool valid = true;
+        if (arg == "--format") {
+            const auto format = wordFormatFromName(value);
+            if ((valid = format.has_value())) options.format = *format;
+        } else if (arg == "--endian") {
+            const auto endian = endianFromName(value);
+            if ((valid = endian.has_value())) options.endian = *endian;
+        } else {
+            const auto flush = flushPolicyFromName(value);
+            if ((valid = flush.has_value())) options.flush = *flush;
+        }
+        if (!valid) {
+            std::cerr << "Invalid value for " << arg << ": " << value << "\n";
+            return 1;
+        }
     }
 
-    std::ofstream out(disshFilename, std::ios::trunc);
-    if (!out) {
-        std::cerr << "Failed to write file: " << disshFilename << "\n";
-        return false;
+    try {
+        OutputWriter out(STDOUT_FILENO, OutputMode::Write);
+        decodeWordStream(STDIN_FILENO, options, out);
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << "\n";
+        return 1;
     }
 
-    for (auto& l : cleaned) out << l << "\n";
-    return true;
+    return 0;
 }
 
-std::string hexToBinaryString(const std::string& hex4) {
-    static const char* lut[16] = {
-        "0000","0001","0010","0011","0100","0101","0110","0111",
-        "1000","1001","1010","1011","1100","1101","1110","1111"
-    };
+int processClient(int argc, char* argv[]) {
+    ISA isa = ISA::SuperH4;
+    std::vector<std::string_view> binaryCodes;
+    for (int i = 3; i < argc; ++i) {
+        const std::string_view arg = argv[i];
+        if (arg.rfind("--SuperH", 0) != 0) {
+            binaryCodes.push_back(arg);
+            continue;
+        }
+        const auto flagIsa = isaFromFlag(arg);
+        if (!flagIsa) {
+            std::cerr << "Unknown ISA flag: " << arg << "\n";
+            return 1;
+        }
+        isa = *flagIsa;
+    }
+
+    std::vector<uint16_t> words;
+    for (const std::string_view binaryCode : binaryCodes)
+        if (const auto word = binaryToWord(binaryCode)) words.push_back(*word);
 
-    if (hex4.length() != 4)
-        throw std::runtime_error("Invalid hex length, expected 4 characters.");
+    try {
+        DecodeClient client(argv[2]);
+        const std::vector<std::string> texts = client.decode(words, isa);
 
-    std::string bin;
-    for (char c : hex4) {
-        if (!isHexChar(c)) throw std::runtime_error("Invalid hex character.");
-        int val = std::isdigit(c) ? c - '0' : std::tolower(c) - 'a' + 10;
-        bin += lut[val];
+        size_t next = 0;
+        for (const std::string_view binaryCode : binaryCodes) {
+            if (binaryToWord(binaryCode)) std::cout << "Assembly: " << texts[next++] << "\n";
+            else std::cout << "Assembly: word" << binaryCode << "\n";
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << "\n";
+        return 1;
     }
-    return bin;
+
+    return 0;
 }
 
-using ISAFunction = std::string(*)(std::string_view);
-
-ISAFunction getISAFunction(const std::string& isaFlag) {
-    if (isaFlag == "--SuperH1") return SuperH1;
-    if (isaFlag == "--SuperH2") return SuperH2;
-    if (isaFlag == "--SuperH3DSP") return SuperH3DSP;
-    if (isaFlag == "--SuperH3E") return SuperH3E;
-    if (isaFlag == "--SuperH3") return SuperH3;
-    if (isaFlag == "--SuperH4A") return SuperH4A;
-    if (isaFlag == "--SuperH4") return SuperH4;
-    if (isaFlag == "--SuperHDSP") return SuperHDSP;
-    return nullptr;
+int processRawFile(FileOptions& options) {
+    options.listing.endian = options.endian.value_or(Endian::Big);
+    options.listing.address = static_cast<uint32_t>(options.base + options.offset);
+
+    try {
+        OutputWriter out = makeWriter(options.output);
+        out.trackStats(options.listing.stats);
+        out.traceFlushes(options.listing.tracer);
+        if (options.filename == "-") {
+            std::cin.ignore(static_cast<std::streamsize>(options.offset));
+            if (options.length) options.listing.limit = std::min<uint64_t>(options.listing.limit, *options.length / 2);
+            printListing(std::cin, options.listing, out);
+        } else {
+            std::optional<MappedFile> image;
+            {
+                const TraceSpan span(options.listing.tracer, "load file");
+                image.emplace(options.filename, options.offset, options.length);
+            }
+            printListing(*image, image->bytes(), options.listing, out);
+        }
+        if (options.listing.histogram) options.listing.histogram->closeSection(options.filename);
+        out.flush();
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << "\n";
+        return 1;
+    }
+
+    return 0;
 }
 
 int main(int argc, char* argv[]) {
+    std::ios::sync_with_stdio(false);
+
     if (argc < 2 || std::string(argv[1]) == "--help") {
         printUsage(argv[0]);
         return 0;
@@ -172,73 +455,89 @@ int main(int argc, char* argv[]) {
 
     std::string arg1 = argv[1];
 
-    if (arg1 == "--file") {
-        if (argc < 3) {
-            std::cerr << "--file requires a filename.\n";
-            printUsage(argv[0]);
+    if (arg1 == "--stdin") return processStdin(argc, argv);
+
+    if (arg1 == "--write-render-table") {
+        if (argc != 3) {
+            std::cerr << "--write-render-table requires a filename.\n";
             return 1;
         }
 
-        std::string filename = argv[2];
-        std::optional<std::string> section = std::nullopt;
-        ISAFunction isaFunc = SuperH4;  
-        size_t numberToProcess = 50;    
-
-        for (int i = 3; i < argc; ++i) {
-            std::string arg = argv[i];
-            if (arg.rfind("--SuperH", 0) == 0) {
-                isaFunc = getISAFunction(arg);
-                if (!isaFunc) {
-                    std::cerr << "Unknown ISA flag: " << arg << "\n";
-                    return 1;
-                }
-            } else if (arg == "--number") {
-                if (i + 1 >= argc) {
-                    std::cerr << "--number requires a value.\n";
-                    return 1;
-                }
-                numberToProcess = std::stoul(argv[++i]);
-            } else if (!section.has_value()) {
-                section = arg;
-            }
+        const std::vector<std::byte> blob = buildRenderTable();
+        std::ofstream file(argv[2], std::ios::binary);
+        if (!file.write(reinterpret_cast<const char*>(blob.data()), static_cast<std::streamsize>(blob.size()))) {
+            std::cerr << "Error: Failed to write " << argv[2] << "\n";
+            return 1;
         }
+        return 0;
+    }
 
-        std::string cmd = "objdump -s " + filename + " >> " + filename + ".DisSH";
-        if (system(cmd.c_str()) != 0) {
-            std::cerr << "Failed to run objdump.\n";
+    if (arg1 == "--daemon" || arg1 == "--client") {
+        if (argc < 3) {
+            std::cerr << arg1 << " requires a socket path.\n";
+            printUsage(argv[0]);
             return 1;
         }
+        if (arg1 == "--client") return processClient(argc, argv);
 
-        if (!processDisSHFile(filename + ".DisSH", section)) {
-            std::cerr << "File processing failed.\n";
+        try {
+            runDecodeServer(argv[2]);
+        } catch (const std::exception& e) {
+            std::cerr << "Error: " << e.what() << "\n";
             return 1;
         }
+        return 0;
+    }
 
-        std::ifstream processed(filename + ".DisSH");
-        if (!processed) {
-            std::cerr << "Processed file could not be read.\n";
+    if (arg1 == "--file" || arg1 == "--raw" || arg1 == "--batch") {
+        if (argc < 3) {
+            std::cerr << arg1 << " requires a filename.\n";
+            printUsage(argv[0]);
             return 1;
         }
 
-        std::vector<std::string> allChunks;
-        std::string line;
-        while (std::getline(processed, line)) {
-            for (size_t i = 0; i + 4 <= line.size(); i += 4)
-                allChunks.push_back(line.substr(i, 4));
+        const InputKind kind = arg1 == "--raw" ? InputKind::Raw : arg1 == "--batch" ? InputKind::Batch : InputKind::Elf;
+        FileOptions options;
+        if (!parseFileOptions(argc, argv, kind, options)) return 1;
+
+        std::optional<MappedRenderTable> renderTable;
+        try {
+            if (options.renderTable) {
+                renderTable.emplace(*options.renderTable);
+                options.listing.renderTable = &renderTable->table();
+            } else {
+                options.listing.renderTable = embeddedRenderTable();
+            }
+        } catch (const std::exception& e) {
+            std::cerr << "Error: " << e.what() << "\n";
+            return 1;
         }
 
-        size_t limit = std::min(numberToProcess, allChunks.size());
-        for (size_t i = 0; i < limit; ++i) {
-            try {
-                std::string binaryStr = hexToBinaryString(allChunks[i]);
-                std::string result = isaFunc(binaryStr);
-                std::cout << "[" << allChunks[i] << "] -> " << result << "\n";
-            } catch (const std::exception& e) {
-                std::cerr << "Conversion error (" << allChunks[i] << "): " << e.what() << "\n";
+        std::optional<Stats> stats;
+        if (options.stats) options.listing.stats = &stats.emplace(options.perf);
+        std::optional<Tracer> tracer;
+        if (options.trace) options.listing.tracer = &tracer.emplace();
+        std::optional<Histogram> histogram;
+        if (options.histogram) options.listing.histogram = &histogram.emplace(options.listing.isa);
+        const auto start = std::chrono::steady_clock::now();
+
+        int status;
+        if (kind == InputKind::Batch) status = processBatch(options);
+        else status = kind == InputKind::Raw ? processRawFile(options) : processElfFile(options);
+
+        if (histogram && status == 0) printHistogram(*histogram, *options.histogram, std::cout);
+        if (stats) printStats(*stats, std::chrono::steady_clock::now() - start, std::cerr);
+        if (tracer) {
+            std::ofstream file(*options.trace);
+            tracer->write(file);
+            if (!file.flush()) {
+                std::cerr << "Error: Failed to write " << *options.trace << "\n";
+                return 1;
             }
+            if (const uint64_t dropped = tracer->dropped())
+                std::cerr << "Trace: " << dropped << " oldest events dropped from full buffers\n";
         }
-
-        return 0;
+        return status;
     }
 
     if (argc != 3) {
@@ -251,13 +550,13 @@ int main(int argc, char* argv[]) {
     std::string_view binaryCode = argv[2];
 
     try {
-        ISAFunction isaFunc = getISAFunction(isaArg);
-        if (!isaFunc) {
+        const auto isa = isaFromFlag(isaArg);
+        if (!isa) {
             std::cerr << "Unknown ISA: " << isaArg << "\n";
             return 1;
         }
 
-        std::string result = isaFunc(binaryCode);
+        std::string result = disassemble(binaryCode, *isa);
         std::cout << "Assembly: " << result << "\n";
     } catch (const std::exception& e) {
         std::cerr << "Error: " << e.what() << "\n";
@@ -0,0 +1,105 @@
+/*
+ * This code is licensed under the GNU AGPLv3
+ * Copyright (c) 2025 GokbakarE
+ * Date: 28-08-2025
+ */
+
+#include "ElfFile.hpp"
+
+#include <cstring>
+#include <stdexcept>
+
+static constexpr size_t ElfHeaderSize = 52;
+static constexpr size_t SectionHeaderSize = 40;
+static constexpr uint16_t SectionIndexExtended = 0xFFFF;
+
+ElfFile::ElfFile(const std::string& path) : file_(path) {
+    const auto bytes = file_.bytes();
+    if (bytes.size() < ElfHeaderSize || std::memcmp(bytes.data(), "\x7F" "ELF", 4) != 0)
+        throw std::runtime_error("Not an ELF file: " + path);
+
+    const auto elfClass = static_cast<uint8_t>(bytes[4]);
+    const auto elfData = static_cast<uint8_t>(bytes[5]);
+    if (elfClass != 1) throw std::runtime_error("Only 32-bit ELF files are supported: " + path);
+    if (elfData != 1 && elfData != 2) throw std::runtime_error("Unknown ELF byte order: " + path);
+    bigEndian_ = elfData == 2;
+
+    const uint32_t sectionOffset = read32(32);
+    const uint16_t sectionEntrySize = read16(46);
+    size_t sectionCount = read16(48);
+    size_t nameSectionIndex = read16(50);
+    if (sectionOffset == 0) return;
+    if (sectionEntrySize < SectionHeaderSize)
+        throw std::runtime_error("Invalid ELF section header size: " + path);
+
+    auto headerAt = [&](size_t index) -> size_t {
+        const size_t offset = sectionOffset + index * sectionEntrySize;
+        if (offset + SectionHeaderSize > bytes.size())
+            throw std::runtime_error("ELF section header out of bounds: " + path);
+        return offset;
+    };
+
+    // Files with more than 0xFF00 sections keep the real counts in section 0.
+    if (sectionCount == 0) sectionCount = read32(headerAt(0) + 20);
+    if (nameSectionIndex == SectionIndexExtended) nameSectionIndex = read32(headerAt(0) + 24);
+
+    // The count sizes the section list, and an extended count can claim
+    // 2^32 sections, so the whole table must lie in the file first.
+    if (sectionOffset > bytes.size() || sectionCount > (bytes.size() - sectionOffset) / sectionEntrySize)
+        throw std::runtime_error("ELF section header table out of bounds: " + path);
+    sections_.reserve(sectionCount);
+    for (size_t i = 0; i < sectionCount; ++i) {
+        const size_t header = headerAt(i);
+        ElfSection section{};
+        section.type = read32(header + 4);
+        section.flags = read32(header + 8);
+        section.address = read32(header + 12);
+        section.offset = read32(header + 16);
+        section.size = read32(header + 20);
+        sections_.push_back(std::move(section));
+    }
+
+    if (nameSectionIndex < sections_.size()) {
+        const std::span<const std::byte> names = sectionData(sections_[nameSectionIndex]);
+        for (size_t i = 0; i < sections_.size(); ++i) {
+            const size_t nameOffset = read32(headerAt(i));
+            if (nameOffset >= names.size()) continue;
+            const char* name = reinterpret_cast<const char*>(names.data()) + nameOffset;
+            sections_[i].name.assign(name, strnlen(name, names.size() - nameOffset));
+        }
+    }
+}
+
+const ElfSection* ElfFile::findSection(std::string_view name) const {
+    for (const ElfSection& section : sections_)
+        if (section.name == name) return &section;
+    return nullptr;
+}
+
+std::vector<const ElfSection*> ElfFile::codeSections() const {
+    std::vector<const ElfSection*> code;
+    for (const ElfSection& section : sections_)
+        if (section.type == SectionProgbits && section.size > 0) code.push_back(&section);
+    return code;
+}
+
+std::span<const std::byte> ElfFile::sectionData(const ElfSection& section) const {
+    if (section.type == SectionNobits) return {};
+
+    const auto bytes = file_.bytes();
+    if (section.offset > bytes.size() || section.size > bytes.size() - section.offset)
+        throw std::runtime_error("ELF section " + section.name + " extends past the end of the file");
+    return bytes.subspan(section.offset, section.size);
+}
+
+uint16_t ElfFile::read16(size_t offset) const {
+    const auto* p = reinterpret_cast<const uint8_t*>(file_.bytes().data()) + offset;
+    return bigEndian_ ? static_cast<uint16_t>(p[0] << 8 | p[1])
+                      : static_cast<uint16_t>(p[1] << 8 | p[0]);
+}
+
+uint32_t ElfFile::read32(size_t offset) const {
+    const auto* p = reinterpret_cast<const uint8_t*>(file_.bytes().data()) + offset;
+    return bigEndian_ ? static_cast<uint32_t>(p[0]) << 24 | p[1] << 16 | p[2] << 8 | p[3]
+                      : static_cast<uint32_t>(p[3]) << 24 | p[2] << 16 | p[1] << 8 | p[0];
+}
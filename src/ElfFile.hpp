@@ -0,0 +1,56 @@
+/*
+ * This code is licensed under the GNU AGPLv3
+ * Copyright (c) 2025 GokbakarE
+ * Date: 28-08-2025
+ */
+
+#pragma once
+#ifndef ELFFILE_H
+#define ELFFILE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "MappedFile.hpp"
+
+struct ElfSection {
+    std::string name;
+    uint32_t type;
+    uint32_t flags;
+    uint32_t address;
+    uint32_t offset;
+    uint32_t size;
+};
+
+// Reader for 32-bit ELF files of either byte order. The file is mapped, not
+// copied; section contents are views into the mapping.
+class ElfFile {
+public:
+    static constexpr uint32_t SectionProgbits = 1;
+    static constexpr uint32_t SectionNobits = 8;
+
+    explicit ElfFile(const std::string& path);
+
+    bool bigEndian() const { return bigEndian_; }
+    const MappedFile& file() const { return file_; }
+    const std::vector<ElfSection>& sections() const { return sections_; }
+
+    const ElfSection* findSection(std::string_view name) const;
+    // Non-empty PROGBITS sections, in file order.
+    std::vector<const ElfSection*> codeSections() const;
+    std::span<const std::byte> sectionData(const ElfSection& section) const;
+
+private:
+    uint16_t read16(size_t offset) const;
+    uint32_t read32(size_t offset) const;
+
+    MappedFile file_;
+    bool bigEndian_ = false;
+    std::vector<ElfSection> sections_;
+};
+
+#endif
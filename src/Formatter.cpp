@@ -0,0 +1,230 @@
+/*
+ * This code is licensed under the GNU AGPLv3
+ * Copyright (c) 2025 GokbakarE
+ * Date: 28-08-2025
+ */
+
+#include "Formatter.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+static constexpr std::string_view GeneralRegisters[16] = {
+    "R0", "R1", "R2", "R3", "R4", "R5", "R6", "R7",
+    "R8", "R9", "R10", "R11", "R12", "R13", "R14", "R15"
+};
+
+static constexpr std::string_view FloatRegisters[16] = {
+    "FR0", "FR1", "FR2", "FR3", "FR4", "FR5", "FR6", "FR7",
+    "FR8", "FR9", "FR10", "FR11", "FR12", "FR13", "FR14", "FR15"
+};
+
+static constexpr std::string_view DoubleRegisters[8] = {
+    "DR0", "DR1", "DR2", "DR3", "DR4", "DR5", "DR6", "DR7"
+};
+
+static constexpr std::string_view ExtendedRegisters[8] = {
+    "XD0", "XD1", "XD2", "XD3", "XD4", "XD5", "XD6", "XD7"
+};
+
+static constexpr std::string_view VectorRegisters[4] = {"FV0", "FV4", "FV8", "FV12"};
+
+static constexpr std::string_view DspAsRegisters[4] = {"R4", "R5", "R2", "R3"};
+static constexpr std::string_view DspAxRegisters[2] = {"R4", "R5"};
+static constexpr std::string_view DspAyRegisters[2] = {"R6", "R7"};
+static constexpr std::string_view DspDxRegisters[2] = {"X0", "X1"};
+static constexpr std::string_view DspDyRegisters[2] = {"Y0", "Y1"};
+static constexpr std::string_view DspDaRegisters[2] = {"A0", "A1"};
+
+// Empty names are reserved encodings.
+static constexpr std::string_view DspDsRegisters[16] = {
+    "", "", "", "", "", "A1", "", "A0",
+    "X0", "X1", "Y0", "Y1", "M0", "A1G", "M1", "A0G"
+};
+
+struct NumberText {
+    char digits[3];
+    uint8_t length;
+};
+
+static constexpr std::array<NumberText, 256> DecimalText = [] {
+    std::array<NumberText, 256> table{};
+    for (unsigned value = 0; value < 256; ++value) {
+        auto& entry = table[value];
+        if (value >= 100) entry.digits[entry.length++] = static_cast<char>('0' + value / 100);
+        if (value >= 10) entry.digits[entry.length++] = static_cast<char>('0' + value / 10 % 10);
+        entry.digits[entry.length++] = static_cast<char>('0' + value % 10);
+    }
+    return table;
+}();
+
+static constexpr char HexDigits[] = "0123456789ABCDEF";
+
+static constexpr std::string_view NibbleBits[16] = {
+    "0000", "0001", "0010", "0011", "0100", "0101", "0110", "0111",
+    "1000", "1001", "1010", "1011", "1100", "1101", "1110", "1111"
+};
+
+static char* writeText(char* out, std::string_view text) {
+    std::memcpy(out, text.data(), text.size());
+    return out + text.size();
+}
+
+static char* writeDecimal(char* out, unsigned value) {
+    const NumberText& text = DecimalText[value];
+    std::memcpy(out, text.digits, sizeof text.digits);
+    return out + text.length;
+}
+
+static char* writeHex(char* out, unsigned value) {
+    if (value >= 0x100) *out++ = HexDigits[value >> 8];
+    if (value >= 0x10) *out++ = HexDigits[(value >> 4) & 0xF];
+    *out++ = HexDigits[value & 0xF];
+    return out;
+}
+
+static size_t formatWord(uint16_t word, char* out) {
+    char* cursor = writeText(out, "word");
+    for (int shift = 12; shift >= 0; shift -= 4)
+        cursor = writeText(cursor, NibbleBits[(word >> shift) & 0xF]);
+    return static_cast<size_t>(cursor - out);
+}
+
+size_t formatInsn(const DecodedInsn& insn, const CompiledFormat* formats, char* out) noexcept {
+    if (insn.opcode == NoOpcode) return formatWord(insn.word, out);
+
+    const CompiledFormat& format = formats[insn.opcode];
+    char* cursor = out;
+    for (uint8_t i = 0; i < format.count; ++i) {
+        const FormatToken& token = format.tokens[i];
+        cursor = writeText(cursor, token.literal);
+
+        switch (token.operand) {
+            case Operand::None: break;
+            case Operand::Rn: cursor = writeText(cursor, GeneralRegisters[insn.rn]); break;
+            case Operand::Rm: cursor = writeText(cursor, GeneralRegisters[insn.rm]); break;
+            case Operand::FRn: cursor = writeText(cursor, FloatRegisters[insn.rn]); break;
+            case Operand::FRm: cursor = writeText(cursor, FloatRegisters[insn.rm]); break;
+            case Operand::DRn: cursor = writeText(cursor, DoubleRegisters[insn.rn >> 1]); break;
+            case Operand::DRm: cursor = writeText(cursor, DoubleRegisters[insn.rm >> 1]); break;
+            case Operand::XDn: cursor = writeText(cursor, ExtendedRegisters[insn.rn >> 1]); break;
+            case Operand::XDm: cursor = writeText(cursor, ExtendedRegisters[insn.rm >> 1]); break;
+            case Operand::FVn: cursor = writeText(cursor, VectorRegisters[insn.rn >> 2]); break;
+            case Operand::FVm: cursor = writeText(cursor, VectorRegisters[insn.rn & 3]); break;
+            case Operand::Imm8: cursor = writeDecimal(cursor, insn.imm8); break;
+            case Operand::Imm7: cursor = writeDecimal(cursor, (insn.word >> 4) & 0x7F); break;
+            case Operand::Disp8: cursor = writeDecimal(cursor, insn.imm8); break;
+            case Operand::Disp4: cursor = writeDecimal(cursor, insn.disp4); break;
+            case Operand::Disp8Hex: cursor = writeHex(cursor, insn.imm8); break;
+            case Operand::Disp12Hex: cursor = writeHex(cursor, insn.disp12); break;
+            case Operand::DspAs: cursor = writeText(cursor, DspAsRegisters[insn.rn & 3]); break;
+            case Operand::DspDs: {
+                const std::string_view name = DspDsRegisters[insn.rm];
+                if (name.empty()) return formatWord(insn.word, out);
+                cursor = writeText(cursor, name);
+                break;
+            }
+            case Operand::DspAx: cursor = writeText(cursor, DspAxRegisters[(insn.rn >> 1) & 1]); break;
+            case Operand::DspDx: cursor = writeText(cursor, DspDxRegisters[insn.rm >> 3]); break;
+            case Operand::DspDa: cursor = writeText(cursor, DspDaRegisters[insn.rm >> 3]); break;
+            case Operand::DspAy: cursor = writeText(cursor, DspAyRegisters[insn.rn & 1]); break;
+            case Operand::DspDy: cursor = writeText(cursor, DspDyRegisters[(insn.rm >> 2) & 1]); break;
+            case Operand::DspDaY: cursor = writeText(cursor, DspDaRegisters[(insn.rm >> 2) & 1]); break;
+        }
+    }
+    return static_cast<size_t>(cursor - out);
+}
+
+// Name of the register an operand slot of insn refers to; empty for
+// immediates, displacements and reserved encodings.
+static std::string_view operandRegister(const DecodedInsn& insn, const Operand operand) {
+    switch (operand) {
+        case Operand::Rn: return GeneralRegisters[insn.rn];
+        case Operand::Rm: return GeneralRegisters[insn.rm];
+        case Operand::FRn: return FloatRegisters[insn.rn];
+        case Operand::FRm: return FloatRegisters[insn.rm];
+        case Operand::DRn: return DoubleRegisters[insn.rn >> 1];
+        case Operand::DRm: return DoubleRegisters[insn.rm >> 1];
+        case Operand::XDn: return ExtendedRegisters[insn.rn >> 1];
+        case Operand::XDm: return ExtendedRegisters[insn.rm >> 1];
+        case Operand::FVn: return VectorRegisters[insn.rn >> 2];
+        case Operand::FVm: return VectorRegisters[insn.rn & 3];
+        case Operand::DspAs: return DspAsRegisters[insn.rn & 3];
+        case Operand::DspDs: return DspDsRegisters[insn.rm];
+        case Operand::DspAx: return DspAxRegisters[(insn.rn >> 1) & 1];
+        case Operand::DspDx: return DspDxRegisters[insn.rm >> 3];
+        case Operand::DspDa: return DspDaRegisters[insn.rm >> 3];
+        case Operand::DspAy: return DspAyRegisters[insn.rn & 1];
+        case Operand::DspDy: return DspDyRegisters[(insn.rm >> 2) & 1];
+        case Operand::DspDaY: return DspDaRegisters[(insn.rm >> 2) & 1];
+        default: return {};
+    }
+}
+
+static bool isNameChar(const char c) {
+    return (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z') || (c >= '0' && c <= '9') || c == '_';
+}
+
+size_t insnRegisters(const DecodedInsn& insn, const CompiledFormat* formats, std::string_view* out) noexcept {
+    if (insn.opcode == NoOpcode) return 0;
+
+    const CompiledFormat& format = formats[insn.opcode];
+    size_t count = 0;
+    const auto add = [&](std::string_view name) {
+        if (count < MaxInsnRegisters) out[count++] = name;
+    };
+    for (uint8_t i = 0; i < format.count; ++i) {
+        const FormatToken& token = format.tokens[i];
+        // Names in the fixed text are registers, apart from the mnemonic
+        // leading the first piece.
+        std::string_view literal = token.literal;
+        if (i == 0) literal.remove_prefix(std::min(literal.find(' '), literal.size()));
+        for (size_t start = 0; start < literal.size();) {
+            if (!isNameChar(literal[start])) {
+                ++start;
+                continue;
+            }
+            size_t end = start;
+            while (end < literal.size() && isNameChar(literal[end])) ++end;
+            add(literal.substr(start, end - start));
+            start = end;
+        }
+
+        if (token.operand == Operand::DspDs && DspDsRegisters[insn.rm].empty()) return 0;
+        if (const std::string_view name = operandRegister(insn, token.operand); !name.empty()) add(name);
+    }
+    return count;
+}
+
+static constexpr uint32_t FormatterHash = [] {
+    uint32_t hash = 2166136261u;
+    const auto mix = [&](std::string_view text) {
+        for (char c : text) hash = (hash ^ static_cast<uint8_t>(c)) * 16777619u;
+        hash = hash * 16777619u;  // separator
+    };
+    const auto mixAll = [&](const auto& names) {
+        for (std::string_view name : names) mix(name);
+    };
+    mixAll(GeneralRegisters);
+    mixAll(FloatRegisters);
+    mixAll(DoubleRegisters);
+    mixAll(ExtendedRegisters);
+    mixAll(VectorRegisters);
+    mixAll(DspAsRegisters);
+    mixAll(DspAxRegisters);
+    mixAll(DspAyRegisters);
+    mixAll(DspDxRegisters);
+    mixAll(DspDyRegisters);
+    mixAll(DspDaRegisters);
+    mixAll(DspDsRegisters);
+    mixAll(NibbleBits);
+    mix(HexDigits);
+    mix("word");
+    for (const NumberText& text : DecimalText) mix({text.digits, text.length});
+    return hash;
+}();
+
+uint32_t formatterHash() noexcept {
+    return FormatterHash;
+}
@@ -0,0 +1,119 @@
+/*
+ * This code is licensed under the GNU AGPLv3
+ * Copyright (c) 2025 GokbakarE
+ * Date: 28-08-2025
+ */
+
+#pragma once
+#ifndef FORMATTER_H
+#define FORMATTER_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include "DecodeTable.hpp"
+#include "SuperH.hpp"
+
+// Operand slots an assembly template can reference with "$<letter>". One
+// letter map, operandLetter() in InstructionTable.cpp, serves every ISA.
+enum class Operand : uint8_t {
+    None,
+    Rn,         // R0..R15, bits 11..8
+    Rm,         // R0..R15, bits 7..4
+    FRn,        // FR0..FR15, bits 11..8
+    FRm,        // FR0..FR15, bits 7..4
+    DRn,        // DR0..DR7, bits 11..9
+    DRm,        // DR0..DR7, bits 7..5
+    XDn,        // XD0..XD7, bits 11..9
+    XDm,        // XD0..XD7, bits 7..5
+    FVn,        // FV0..FV12, bits 11..10
+    FVm,        // FV0..FV12, bits 9..8
+    Imm8,       // decimal, bits 7..0
+    Imm7,       // decimal, bits 10..4
+    Disp8,      // decimal, bits 7..0
+    Disp4,      // decimal, bits 3..0
+    Disp8Hex,   // hex, bits 7..0
+    Disp12Hex,  // hex, bits 11..0
+    DspAs,      // MOVS address register, bits 9..8
+    DspDs,      // MOVS data register, bits 7..4
+    DspAx,      // MOVX address register, bit 9
+    DspDx,      // MOVX load register, bit 7
+    DspDa,      // MOVX store register, bit 7
+    DspAy,      // MOVY address register, bit 8
+    DspDy,      // MOVY load register, bit 6
+    DspDaY      // MOVY store register, bit 6
+};
+
+// A template is pre-tokenized into literal text, each piece followed by an
+// optional operand slot: "MOV.B R0, @($S, $M)" becomes
+// {"MOV.B R0, @(", Disp4}, {", ", Rm}, {")", None}.
+struct FormatToken {
+    std::string_view literal;
+    Operand operand;
+};
+
+inline constexpr size_t MaxFormatTokens = 8;
+
+struct CompiledFormat {
+    std::array<FormatToken, MaxFormatTokens> tokens;
+    uint8_t count;
+};
+
+// Maps the letter after '$' to its operand slot, or None when no slot uses it.
+using OperandLetters = Operand (*)(char letter);
+
+// Longest text any operand slot renders to ("FV12", "R15", "FFF").
+inline constexpr size_t MaxOperandText = 4;
+
+consteval CompiledFormat compileFormat(std::string_view assembly, OperandLetters letters) {
+    CompiledFormat format{};
+    size_t start = 0;
+    size_t rendered = 0;
+    for (size_t i = 0; i < assembly.size(); ++i) {
+        if (assembly[i] != '$' || i + 1 >= assembly.size()) continue;
+
+        const Operand operand = letters(assembly[i + 1]);
+        if (operand == Operand::None) throw "Assembly template uses an operand letter that maps to no slot";
+        if (size_t{format.count} + 1 >= MaxFormatTokens) throw "Assembly template has too many operands";
+
+        format.tokens[format.count++] = {assembly.substr(start, i - start), operand};
+        rendered += i - start + MaxOperandText;
+        start = i + 2;
+        ++i;
+    }
+    format.tokens[format.count++] = {assembly.substr(start), Operand::None};
+    rendered += assembly.size() - start;
+
+    if (rendered > MaxInsnText) throw "Assembly template can render longer than MaxInsnText";
+    return format;
+}
+
+template <size_t N>
+consteval std::array<CompiledFormat, N> compileFormats(const OpcodeEntry (&entries)[N], OperandLetters letters) {
+    std::array<CompiledFormat, N> formats{};
+    for (size_t i = 0; i < N; ++i) formats[i] = compileFormat(entries[i].assembly, letters);
+    return formats;
+}
+
+// Renders insn into out, which must hold at least MaxInsnText characters, and
+// returns the number of characters written. Words without an opcode, and
+// operand encodings the ISA reserves, render as "word" plus the binary string.
+size_t formatInsn(const DecodedInsn& insn, const CompiledFormat* formats, char* out) noexcept;
+
+// Hash of the register names, digits and fallback spelling formatInsn()
+// writes, so data derived from its output can tell when they change.
+uint32_t formatterHash() noexcept;
+
+// Upper bound on the registers one instruction names.
+inline constexpr size_t MaxInsnRegisters = 8;
+
+// Writes the names of the registers insn refers to into out, which must hold
+// MaxInsnRegisters names, and returns how many there are. Both operand slots
+// and registers spelled out in the template ("@(R0, GBR)") count. The names
+// are in order of appearance and refer to static storage; words formatInsn
+// renders as "word..." have none.
+size_t insnRegisters(const DecodedInsn& insn, const CompiledFormat* formats, std::string_view* out) noexcept;
+
+#endif
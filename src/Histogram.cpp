@@ -0,0 +1,258 @@
+/*
+ * This code is licensed under the GNU AGPLv3
+ * Copyright (c) 2025 GokbakarE
+ * Date: 28-08-2025
+ */
+
+#include "Histogram.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <iomanip>
+#include <utility>
+
+#include "Formatter.hpp"
+#include "InstructionTable.hpp"
+
+std::optional<HistogramFormat> histogramFormatFromName(std::string_view name) {
+    if (name == "table") return HistogramFormat::Table;
+    if (name == "json") return HistogramFormat::Json;
+    return std::nullopt;
+}
+
+std::string_view insnClassName(const InsnClass insnClass) {
+    static constexpr std::string_view Names[InsnClassCount] = {
+        "load", "store", "move", "arithmetic", "logic", "shift",
+        "compare", "branch", "system", "float", "dsp", "invalid"
+    };
+    return Names[static_cast<size_t>(insnClass)];
+}
+
+// Splits operand text at the commas outside parentheses, keeping the first
+// and last operand.
+static std::pair<std::string_view, std::string_view> outerOperands(std::string_view operands) {
+    size_t first = operands.size();
+    size_t last = 0;
+    int depth = 0;
+    for (size_t i = 0; i < operands.size(); ++i) {
+        if (operands[i] == '(') ++depth;
+        else if (operands[i] == ')') --depth;
+        else if (operands[i] == ',' && depth == 0) {
+            first = std::min(first, i);
+            last = i + 1;
+        }
+    }
+    std::string_view lastOperand = operands.substr(last);
+    while (!lastOperand.empty() && lastOperand.front() == ' ') lastOperand.remove_prefix(1);
+    return {operands.substr(0, first), lastOperand};
+}
+
+static bool startsWith(std::string_view text, std::string_view prefix) {
+    return text.substr(0, prefix.size()) == prefix;
+}
+
+// Classifies a rendered instruction by its mnemonic and, for moves, loads
+// and stores, by which side of it addresses memory.
+static InsnClass classify(std::string_view text) {
+    const size_t space = std::min(text.find(' '), text.size());
+    const std::string_view mnemonic = text.substr(0, space);
+    const std::string_view operands = text.substr(std::min(space + 1, text.size()));
+
+    const auto isOneOf = [&](std::initializer_list<std::string_view> names) {
+        return std::find(names.begin(), names.end(), mnemonic) != names.end();
+    };
+
+    if (startsWith(mnemonic, "F")) return InsnClass::Float;
+    if (startsWith(mnemonic, "MOVS.") || isOneOf({"LDRE", "LDRS", "SETRC"})) return InsnClass::Dsp;
+    if (isOneOf({"BF", "BF/S", "BT", "BT/S", "BRA", "BRAF", "BSR", "BSRF", "JMP", "JSR", "RTS", "RTE"}))
+        return InsnClass::Branch;
+    if (startsWith(mnemonic, "CMP/") || isOneOf({"TST", "TST.B", "TAS.B"})) return InsnClass::Compare;
+    if (startsWith(mnemonic, "SH") || startsWith(mnemonic, "ROT")) return InsnClass::Shift;
+    if (isOneOf({"AND", "AND.B", "OR", "OR.B", "XOR", "XOR.B", "NOT"})) return InsnClass::Logic;
+    if (isOneOf({"DT", "NEG", "NEGC", "MAC.L", "MAC.W", "DMULS.L", "DMULU.L"}) || startsWith(mnemonic, "ADD") ||
+        startsWith(mnemonic, "SUB") || startsWith(mnemonic, "MUL") || startsWith(mnemonic, "DIV") ||
+        startsWith(mnemonic, "EXT"))
+        return InsnClass::Arithmetic;
+    if (mnemonic == "MOVA" || startsWith(mnemonic, "SWAP.") || mnemonic == "XTRCT") return InsnClass::Move;
+
+    const bool move = startsWith(mnemonic, "MOV");
+    if (move || startsWith(mnemonic, "LD") || startsWith(mnemonic, "ST")) {
+        const auto [first, last] = outerOperands(operands);
+        if (startsWith(first, "@")) return InsnClass::Load;
+        if (startsWith(last, "@")) return InsnClass::Store;
+        if (move) return InsnClass::Move;
+    }
+    return InsnClass::System;
+}
+
+// The template of opcode with every operand slot spelled as what it holds,
+// e.g. "MOV.L @(disp, PC), Rn".
+static std::string opcodeForm(const uint16_t opcode) {
+    static constexpr std::pair<Operand, std::string_view> Placeholders[] = {
+        {Operand::Rn, "Rn"}, {Operand::Rm, "Rm"}, {Operand::FRn, "FRn"}, {Operand::FRm, "FRm"},
+        {Operand::DRn, "DRn"}, {Operand::DRm, "DRm"}, {Operand::XDn, "XDn"}, {Operand::XDm, "XDm"},
+        {Operand::FVn, "FVn"}, {Operand::FVm, "FVm"}, {Operand::Imm8, "imm"}, {Operand::Imm7, "imm"},
+        {Operand::Disp8, "disp"}, {Operand::Disp4, "disp"}, {Operand::Disp8Hex, "disp"},
+        {Operand::Disp12Hex, "disp"}, {Operand::DspAs, "As"}, {Operand::DspDs, "Ds"}, {Operand::DspAx, "Ax"},
+        {Operand::DspDx, "Dx"}, {Operand::DspDa, "Da"}, {Operand::DspAy, "Ay"}, {Operand::DspDy, "Dy"},
+        {Operand::DspDaY, "Da"}
+    };
+
+    const CompiledFormat& format = InstructionFormats[opcode];
+    std::string form;
+    for (uint8_t i = 0; i < format.count; ++i) {
+        form += format.tokens[i].literal;
+        for (const auto& [operand, name] : Placeholders)
+            if (operand == format.tokens[i].operand) form += name;
+    }
+    return form;
+}
+
+Histogram::Histogram(const ISA isa) : isa_(isa) {}
+
+void Histogram::count(const std::span<const uint16_t> words) {
+    std::array<uint64_t, 65536>& counts = threads_.local().words;
+    for (const uint16_t word : words) ++counts[word];
+}
+
+void Histogram::closeSection(std::string name) {
+    SectionHistogram& section = sections_.emplace_back();
+    section.name = std::move(name);
+    section.opcodes.assign(instructionCount(), 0);
+
+    // A table given back by an exited thread keeps its counts, so every table
+    // is folded in.
+    std::vector<uint64_t> counts(65536);
+    threads_.forEach([&](WordCounts& thread) {
+        for (size_t word = 0; word < 65536; ++word) counts[word] += std::exchange(thread.words[word], 0);
+    });
+
+    for (size_t word = 0; word < 65536; ++word) {
+        const uint64_t count = counts[word];
+        if (count == 0) continue;
+        section.instructions += count;
+
+        // Operand encodings the ISA reserves render as "word..." too.
+        const DecodedInsn insn = decode(static_cast<uint16_t>(word), isa_);
+        char text[MaxInsnText];
+        const size_t length = format(insn, isa_, text);
+        if (insn.opcode == NoOpcode || text[0] == 'w') {
+            section.classes[static_cast<size_t>(InsnClass::Invalid)] += count;
+            continue;
+        }
+        section.opcodes[insn.opcode] += count;
+        section.classes[static_cast<size_t>(classify({text, length}))] += count;
+
+        std::string_view registers[MaxInsnRegisters];
+        const size_t named = insnRegisters(insn, InstructionFormats, registers);
+        for (size_t i = 0; i < named; ++i) section.registers[registers[i]] += count;
+    }
+}
+
+struct HistogramRow {
+    std::string name;
+    uint64_t count;
+    // Opcode id, for opcode rows.
+    std::optional<uint16_t> id;
+};
+
+// Rows with a count, most frequent first and ties by name.
+static std::vector<HistogramRow> sortedRows(std::vector<HistogramRow> rows) {
+    std::erase_if(rows, [](const HistogramRow& row) { return row.count == 0; });
+    std::sort(rows.begin(), rows.end(), [](const HistogramRow& a, const HistogramRow& b) {
+        if (a.count != b.count) return a.count > b.count;
+        return a.name < b.name;
+    });
+    return rows;
+}
+
+static std::vector<HistogramRow> opcodeRows(const SectionHistogram& section) {
+    std::vector<HistogramRow> rows;
+    for (size_t opcode = 0; opcode < section.opcodes.size(); ++opcode) {
+        if (section.opcodes[opcode] == 0) continue;
+        const auto id = static_cast<uint16_t>(opcode);
+        rows.push_back({opcodeForm(id), section.opcodes[opcode], id});
+    }
+    return sortedRows(std::move(rows));
+}
+
+static std::vector<HistogramRow> classRows(const SectionHistogram& section) {
+    std::vector<HistogramRow> rows;
+    for (size_t i = 0; i < InsnClassCount; ++i)
+        rows.push_back({std::string(insnClassName(static_cast<InsnClass>(i))), section.classes[i], std::nullopt});
+    return sortedRows(std::move(rows));
+}
+
+static std::vector<HistogramRow> registerRows(const SectionHistogram& section) {
+    std::vector<HistogramRow> rows;
+    for (const auto& [name, count] : section.registers) rows.push_back({std::string(name), count, std::nullopt});
+    return sortedRows(std::move(rows));
+}
+
+static void printTable(const Histogram& histogram, std::ostream& out) {
+    for (const SectionHistogram& section : histogram.sections()) {
+        out << "Section " << section.name << " (" << isaName(histogram.isa()) << "): " << section.instructions
+            << " instructions\n";
+        const double total = std::max<double>(static_cast<double>(section.instructions), 1);
+        const auto table = [&](std::string_view title, const std::vector<HistogramRow>& rows) {
+            out << "\n  " << std::left << std::setw(32) << title << std::right << std::setw(16) << "count"
+                << std::setw(10) << "share" << "\n";
+            for (const HistogramRow& row : rows)
+                out << "  " << std::left << std::setw(32) << row.name << std::right << std::setw(16) << row.count
+                    << std::setw(9) << std::fixed << std::setprecision(2)
+                    << static_cast<double>(row.count) * 100 / total << "%\n";
+        };
+        table("opcode", opcodeRows(section));
+        table("class", classRows(section));
+        table("register", registerRows(section));
+        out << "\n";
+    }
+}
+
+static void writeJsonString(std::ostream& out, std::string_view text) {
+    out << '"';
+    for (const char c : text) {
+        if (c == '"' || c == '\\') {
+            out << '\\' << c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            char escaped[8];
+            std::snprintf(escaped, sizeof escaped, "\\u%04x", static_cast<unsigned>(c));
+            out << escaped;
+        } else {
+            out << c;
+        }
+    }
+    out << '"';
+}
+
+static void printJson(const Histogram& histogram, std::ostream& out) {
+    const auto rows = [&](std::string_view key, std::string_view nameKey, const std::vector<HistogramRow>& rows) {
+        out << ", \"" << key << "\": [";
+        for (size_t i = 0; i < rows.size(); ++i) {
+            out << (i ? ",\n" : "\n") << "      {";
+            if (rows[i].id) out << "\"id\": " << *rows[i].id << ", ";
+            out << "\"" << nameKey << "\": ";
+            writeJsonString(out, rows[i].name);
+            out << ", \"count\": " << rows[i].count << "}";
+        }
+        out << "\n    ]";
+    };
+
+    out << "{\"isa\": \"" << isaName(histogram.isa()) << "\", \"sections\": [";
+    const std::vector<SectionHistogram>& sections = histogram.sections();
+    for (size_t i = 0; i < sections.size(); ++i) {
+        out << (i ? ",\n" : "\n") << "  {\"name\": ";
+        writeJsonString(out, sections[i].name);
+        out << ", \"instructions\": " << sections[i].instructions;
+        rows("opcodes", "form", opcodeRows(sections[i]));
+        rows("classes", "class", classRows(sections[i]));
+        rows("registers", "register", registerRows(sections[i]));
+        out << "}";
+    }
+    out << "\n]}\n";
+}
+
+void printHistogram(const Histogram& histogram, const HistogramFormat format, std::ostream& out) {
+    if (format == HistogramFormat::Json) printJson(histogram, out);
+    else printTable(histogram, out);
+}
@@ -0,0 +1,99 @@
+/*
+ * This code is licensed under the GNU AGPLv3
+ * Copyright (c) 2025 GokbakarE
+ * Date: 28-08-2025
+ */
+
+#pragma once
+#ifndef HISTOGRAM_H
+#define HISTOGRAM_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <ostream>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "SuperH.hpp"
+#include "ThreadSlots.hpp"
+
+enum class HistogramFormat : uint8_t {
+    Table,  // sorted, aligned text
+    Json
+};
+
+// Parses "table" or "json".
+std::optional<HistogramFormat> histogramFormatFromName(std::string_view name);
+
+// Coarse kinds of instruction counted by --histogram.
+enum class InsnClass : uint8_t {
+    Load,        // memory to register
+    Store,       // register to memory
+    Move,        // register to register, immediates
+    Arithmetic,
+    Logic,
+    Shift,
+    Compare,
+    Branch,
+    System,      // control registers, cache, traps, flags
+    Float,
+    Dsp,
+    Invalid      // no instruction for the ISA
+};
+
+inline constexpr size_t InsnClassCount = 12;
+
+std::string_view insnClassName(InsnClass insnClass);
+
+// Counts of one section, in the order sections were closed.
+struct SectionHistogram {
+    std::string name;
+    uint64_t instructions = 0;
+    // Indexed by opcode.
+    std::vector<uint64_t> opcodes;
+    std::array<uint64_t, InsnClassCount> classes = {};
+    // Keyed by register name, as written in the listing.
+    std::map<std::string_view, uint64_t> registers;
+};
+
+// Frequency counts of the instructions of a run, kept per section. Listing
+// threads only count halfwords into their own table, so counting costs one
+// increment per instruction with no decoding or formatting; each distinct
+// word is decoded once, when its section is closed.
+class Histogram {
+public:
+    explicit Histogram(ISA isa);
+
+    ISA isa() const { return isa_; }
+
+    // Counts words into the calling thread's table, taken on first use from
+    // an exited thread or else created.
+    void count(std::span<const uint16_t> words);
+
+    // Folds everything counted since the previous section into a section
+    // called name. Call only while no thread is counting.
+    void closeSection(std::string name);
+
+    const std::vector<SectionHistogram>& sections() const { return sections_; }
+
+private:
+    struct alignas(64) WordCounts {
+        std::array<uint64_t, 65536> words = {};
+    };
+
+    ISA isa_;
+    // 512 KB each, so only as many as threads ever counted at once.
+    ThreadSlots<WordCounts> threads_;
+    std::vector<SectionHistogram> sections_;
+};
+
+// Writes every section of histogram with its opcodes, classes and registers,
+// each sorted by descending count.
+void printHistogram(const Histogram& histogram, HistogramFormat format, std::ostream& out);
+
+#endif
@@ -0,0 +1,485 @@
+/*
+ * This code is licensed under the GNU AGPLv3
+ * Copyright (c) 2025 GokbakarE
+ * Date: 28-08-2025
+ */
+
+#include "InstructionTable.hpp"
+
+static constexpr uint8_t SH1 = isaBit(ISA::SuperH1);
+static constexpr uint8_t SH2 = isaBit(ISA::SuperH2);
+static constexpr uint8_t SH3 = isaBit(ISA::SuperH3);
+static constexpr uint8_t SH3E = isaBit(ISA::SuperH3E);
+static constexpr uint8_t SH3DSP = isaBit(ISA::SuperH3DSP);
+static constexpr uint8_t SH4 = isaBit(ISA::SuperH4);
+static constexpr uint8_t SH4A = isaBit(ISA::SuperH4A);
+static constexpr uint8_t SHDSP = isaBit(ISA::SuperHDSP);
+static constexpr uint8_t ALL = SH1 | SH2 | SH3 | SH3E | SH3DSP | SH4 | SH4A | SHDSP;
+
+// Every SuperH instruction form, once. Rows whose text differs between ISAs
+// (e.g. "#" before immediates on the later cores) appear once per spelling.
+static constexpr OpcodeEntry Instructions[] = {
+    {"0011nnnnmmmm1100", "ADD $M, $N", ALL},
+    {"0111nnnniiiiiiii", "ADD $I, $N", SH1 | SH2 | SH3},
+    {"0111nnnniiiiiiii", "ADD #$I, $N", SH3E | SH3DSP | SH4 | SH4A | SHDSP},
+    {"0011nnnnmmmm1110", "ADDC $M, $N", ALL},
+    {"0011nnnnmmmm1111", "ADDV $M, $N", ALL},
+    {"0010nnnnmmmm1001", "AND $M, $N", ALL},
+    {"11001001iiiiiiii", "AND $I, R0", SH1 | SH2 | SH3},
+    {"11001001iiiiiiii", "AND #$I, R0", SH3E | SH3DSP | SH4 | SH4A | SHDSP},
+    {"11001101iiiiiiii", "AND.B $I, @(R0, GBR)", SH1 | SH2 | SH3},
+    {"11001101iiiiiiii", "AND.B #$I, @(R0, GBR)", SH3E | SH3DSP | SHDSP},
+    {"11001101iiiiiiii", "AND.B #$I, @(R0, GBR", SH4 | SH4A},
+    {"10001011dddddddd", "BF $D", ALL},
+    {"10001111dddddddd", "BF/S $D", SH2 | SH3 | SH3E | SH3DSP | SH4 | SH4A | SHDSP},
+    {"1010ffffffffffff", "BRA $F", ALL},
+    {"0000nnnn00100011", "BRAF $N", SH2 | SH3 | SH3E | SH3DSP | SH4 | SH4A | SHDSP},
+    {"1011ffffffffffff", "BSR $F", SH2 | SH3 | SH3E | SH3DSP | SH4 | SH4A | SHDSP},
+    {"0000nnnn00000011", "BSRF $N", SH2 | SH3 | SH3E | SH3DSP | SH4 | SH4A | SHDSP},
+    {"10001001dddddddd", "BT $D", ALL},
+    {"10001101dddddddd", "BT/S $D", SH2 | SH3 | SH3E | SH3DSP | SH4 | SH4A | SHDSP},
+    {"0000000000101000", "CLRMAC", ALL},
+    {"0000000001001000", "CLRS", SH3 | SH3E | SH3DSP | SH4 | SH4A},
+    {"0000000000001000", "CLRT", ALL},
+    {"0011nnnnmmmm0000", "CMP/EQ $M, $N", ALL},
+    {"10001000iiiiiiii", "CMP/EQ $I, R0", SH1 | SH2 | SH3},
+    {"10001000iiiiiiii", "CMP/EQ #$I, R0", SH3E | SH3DSP | SHDSP},
+    {"0011nnnnmmmm0011", "CMP/GE $M, $N", ALL},
+    {"0011nnnnmmmm0111", "CMP/GT $M, $N", ALL},
+    {"0011nnnnmmmm0110", "CMP/HI $M, $N", ALL},
+    {"0011nnnnmmmm0010", "CMP/HS $M, $N", ALL},
+    {"0100nnnn00010101", "CMP/PL $N", ALL},
+    {"0100nnnn00010001", "CMP/PZ $N", ALL},
+    {"0010nnnnmmmm1100", "CMP/STR $M, $N", ALL},
+    {"0010nnnnmmmm0111", "DIV0S $M, $N", ALL},
+    {"0000000000011001", "DIV0U", ALL},
+    {"0011nnnnmmmm0100", "DIV1 $M, $N", ALL},
+    {"0011nnnnmmmm1101", "DMULS.L $M, $N", SH2 | SH3 | SH3E | SH3DSP | SH4 | SH4A | SHDSP},
+    {"0011nnnnmmmm0101", "DMULU.L $M, $N", SH2 | SH3 | SH3E | SH3DSP | SH4 | SH4A | SHDSP},
+    {"0100nnnn00010000", "DT $N", SH2 | SH3 | SH3E | SH3DSP | SH4 | SH4A | SHDSP},
+    {"0110nnnnmmmm1110", "EXTS.B $M, $N", ALL},
+    {"0110nnnnmmmm1111", "EXTS.W $M, $N", ALL},
+    {"0110nnnnmmmm1100", "EXTU.B $M, $N", ALL},
+    {"0110nnnnmmmm1101", "EXTU.W $M, $N", ALL},
+    {"1111wwww01011101", "FABS $W", SH3E | SH4 | SH4A},
+    {"1111qqq001011101", "FABS $Q", SH4 | SH4A},
+    {"1111wwwwxxxx0000", "FADD $X, $W", SH3E | SH4 | SH4A},
+    {"1111qqq0zzz00000", "FADD $Z, $Q", SH4 | SH4A},
+    {"1111wwwwxxxx0100", "FCMP/EQ $X, $W", SH3E | SH4 | SH4A},
+    {"1111qqq0zzz00100", "FCMP/EQ $Z, $Q", SH4 | SH4A},
+    {"1111wwwwxxxx0101", "FCMP/GT $X, $W", SH3E | SH4 | SH4A},
+    {"1111qqq0zzz00101", "FCMP/GT $Z, $Q", SH4 | SH4A},
+    {"1111qqq010111101", "FCNVDS $Q, FPUL", SH4 | SH4A},
+    {"1111qqq010101101", "FCNVSD FPUL, $Q", SH4 | SH4A},
+    {"1111wwwwxxxx0011", "FDIV $X, $W", SH3E | SH4 | SH4A},
+    {"1111qqq0zzz00011", "FDIV $Z, $Q", SH4 | SH4A},
+    {"1111ccvv11101101", "FIPR $V, $C", SH4 | SH4A},
+    {"1111wwww10001101", "FLDI0 $W", SH3E | SH4 | SH4A},
+    {"1111wwww10011101", "FLDI1 $W", SH3E | SH4 | SH4A},
+    {"1111wwww00011101", "FLDS $W, FPUL", SH3E | SH4 | SH4A},
+    {"1111wwww00101101", "FLOAT FPUL, $W", SH3E | SH4 | SH4A},
+    {"1111qqq000101101", "FLOAT FPUL, $Q", SH4 | SH4A},
+    {"1111wwwwxxxx1110", "FMAC FR0, $X, $W", SH3E | SH4 | SH4A},
+    {"1111wwwwxxxx1100", "FMOV $X, $W", SH3E | SH4 | SH4A},
+    {"1111qqq0zzz01100", "FMOV $Z, $Q", SH4 | SH4A},
+    {"1111nnnnzzz01010", "FMOV $Z, @$N", SH4 | SH4A},
+    {"1111qqq0mmmm1000", "FMOV @$M, $Q", SH4 | SH4A},
+    {"1111qqq0mmmm1001", "FMOV @$M+, $Q", SH4 | SH4A},
+    {"1111nnnnzzz01011", "FMOV $Z, @-$N", SH4 | SH4A},
+    {"1111qqq0mmmm0110", "FMOV @(R0, $M), $Q", SH4 | SH4A},
+    {"1111nnnnzzz00111", "FMOV $Z, @(R0, $N)", SH4 | SH4A},
+    {"1111nnnnlll11010", "FMOV $L, @$N", SH4 | SH4A},
+    {"1111kkk1mmmm1000", "FMOV @$M, $K", SH4 | SH4A},
+    {"1111kkk1mmmm1001", "FMOV @$M+, $K", SH4 | SH4A},
+    {"1111nnnnlll11011", "FMOV $L, @-$N", SH4 | SH4A},
+    {"1111kkk1mmmm0110", "FMOV @(R0, $M), $K", SH4 | SH4A},
+    {"1111nnnnlll10111", "FMOV $L, @(R0,$N", SH4 | SH4A},
+    {"1111kkk1lll11100", "FMOV $L, $K", SH4 | SH4A},
+    {"1111qqq0lll11100", "FMOV $L, $Q", SH4 | SH4A},
+    {"1111kkk1zzz01100", "FMOV $Z, $K", SH4 | SH4A},
+    {"1111wwwwmmmm1000", "FMOV.S @$M, $W", SH3E | SH4 | SH4A},
+    {"1111nnnnxxxx1010", "FMOV.S $X, @$N", SH3E | SH4 | SH4A},
+    {"1111wwwwmmmm1001", "FMOV.S @+$M, $W", SH3E},
+    {"1111nnnnxxxx1011", "FMOV.S $X, @-$N", SH3E | SH4 | SH4A},
+    {"1111wwwwmmmm0110", "FMOV.S @(R0, $M), $W", SH3E | SH4 | SH4A},
+    {"1111nnnnxxxx0111", "FMOV.S $X, @(R0, $N)", SH3E | SH4 | SH4A},
+    {"1111wwwwmmmm1001", "FMOV.S @$M+, $W", SH4 | SH4A},
+    {"1111wwwwxxxx0010", "FMUL $X, $W", SH3E | SH4 | SH4A},
+    {"1111qqq0zzz00010", "FMUL $Z, $Q", SH4 | SH4A},
+    {"1111wwww01001101", "FNEG $W", SH3E | SH4 | SH4A},
+    {"1111qqq001001101", "FNEG $Q", SH4 | SH4A},
+    {"1111011111111101", "FPCHG", SH4A},
+    {"1111101111111101", "FRCHG", SH4 | SH4A},
+    {"1111qqq011111101", "FSCA FPUL, $Q", SH4A},
+    {"1111001111111101", "FSCHG", SH4},
+    {"1111001111111101", "FSCHG ", SH4A},
+    {"1111wwww01101101", "FSQRT $W", SH3E | SH4 | SH4A},
+    {"1111qqq001101101", "FSQRT $Q", SH4 | SH4A},
+    {"1111wwww01111101", "FSRRA $W", SH4A},
+    {"1111wwww00001101", "FSTS FPUL, $W", SH3E | SH4 | SH4A},
+    {"1111wwwwxxxx0001", "FSUB $X, $W", SH3E | SH4 | SH4A},
+    {"1111qqq0zzz00001", "FSUB $Z, $Q", SH4 | SH4A},
+    {"1111wwww00111101", "FTRC FPUL, $W", SH3E},
+    {"1111wwww00111101", "FTRC $W, FPUL", SH4 | SH4A},
+    {"1111qqq000111101", "FTRC $Q, FPUL", SH4 | SH4A},
+    {"1111cc0111111101", "FTRV XMTRX, $C", SH4 | SH4A},
+    {"0000nnnn11100011", "ICBI @$N", SH4A},
+    {"0100nnnn00101011", "JMP @$N", ALL},
+    {"0100nnnn00001011", "JSR @$N", ALL},
+    {"0100nnnn00001110", "LDC $N, SR", ALL},
+    {"0100nnnn00011110", "LDC $N, GBR", ALL},
+    {"0100nnnn00101110", "LDC $N, VBR", ALL},
+    {"0100nnnn01011110", "LDC $N, MOD", SH1 | SH2 | SH3DSP | SHDSP},
+    {"0100nnnn01111110", "LDC $N, RE", SH1 | SH2 | SH3DSP | SHDSP},
+    {"0100nnnn01101110", "LDC $N, RS", SH1 | SH2 | SH3DSP | SHDSP},
+    {"0100nnnn00111110", "LDC $N, SSR", SH3 | SH3E | SH3DSP | SH4 | SH4A},
+    {"0100nnnn01001110", "LDC $N, SPC", SH3 | SH3E | SH3DSP | SH4 | SH4A},
+    {"0100nnnn10001110", "LDC $N, R0_BANK", SH3 | SH3E | SH3DSP | SH4 | SH4A},
+    {"0100nnnn10011110", "LDC $N, R1_BANK", SH3 | SH3E | SH3DSP | SH4 | SH4A},
+    {"0100nnnn10101110", "LDC $N, R2_BANK", SH3 | SH3E | SH3DSP | SH4 | SH4A},
+    {"0100nnnn10111110", "LDC $N, R3_BANK", SH3 | SH3E | SH3DSP | SH4 | SH4A},
+    {"0100nnnn11001110", "LDC $N, R4_BANK", SH3 | SH3E | SH3DSP | SH4 | SH4A},
+    {"0100nnnn11011110", "LDC $N, R5_BANK", SH3 | SH3E | SH3DSP | SH4 | SH4A},
+    {"0100nnnn11101110", "LDC $N, R6_BANK", SH3 | SH3E | SH3DSP | SH4 | SH4A},
+    {"0100nnnn11111110", "LDC $N, R7_BANK", SH3 | SH3E | SH3DSP | SH4 | SH4A},
+    {"0100nnnn11111010", "LDC $N, DBR", SH4 | SH4A},
+    {"0100nnnn00000111", "LDC.L @$N+, SR", ALL},
+    {"0100nnnn00010111", "LDC.L @$N+, GBR", ALL},
+    {"0100nnnn00100111", "LDC.L @$N+, VBR", ALL},
+    {"0100nnnn01010111", "LDC.L @$N+, MOD", SH1 | SH2 | SH3DSP | SHDSP},
+    {"0100nnnn01110111", "LDC.L @$N+, RE", SH1 | SH2 | SH3DSP | SHDSP},
+    {"0100nnnn01100111", "LDC.L @$N+, RS", SH1 | SH2 | SH3DSP | SHDSP},
+    {"0100nnnn00110111", "LDC.L @$N+, SSR", SH3 | SH3E | SH3DSP | SH4 | SH4A},
+    {"0100nnnn01000111", "LDC.L @$N+, SPC", SH3 | SH3E | SH3DSP | SH4 | SH4A},
+    {"0100nnnn10000111", "LDC.L @$N+, R0_BANK", SH3 | SH3E | SH3DSP | SH4 | SH4A},
+    {"0100nnnn10010111", "LDC.L @$N+, R1_BANK", SH3 | SH3E | SH3DSP | SH4 | SH4A},
+    {"0100nnnn10100111", "LDC.L @$N+, R2_BANK", SH3 | SH3E | SH3DSP | SH4 | SH4A},
+    {"0100nnnn10110111", "LDC.L @$N+, R3_BANK", SH3 | SH3E | SH3DSP | SH4 | SH4A},
+    {"0100nnnn11000111", "LDC.L @$N+, R4_BANK", SH3 | SH3E | SH3DSP | SH4 | SH4A},
+    {"0100nnnn11010111", "LDC.L @$N+, R5_BANK", SH3 | SH3E | SH3DSP | SH4 | SH4A},
+    {"0100nnnn11100111", "LDC.L @$N+, R6_BANK", SH3 | SH3E | SH3DSP | SH4 | SH4A},
+    {"0100nnnn11110111", "LDC.L @$N+, R7_BANK", SH3 | SH3E | SH3DSP | SH4 | SH4A},
+    {"0100nnnn11110110", "LDC.L @$N+, DBR", SH4 | SH4A},
+    {"10001110pppppppp", "LDRE @($P, PC)", SH3DSP | SHDSP},
+    {"10001100pppppppp", "LDRS @($P, PC)", SH3DSP | SHDSP},
+    {"0100nnnn00001010", "LDS $N, MACH", SH1 | SH2 | SH3 | SH3E | SH3DSP | SHDSP},
+    {"0100nnnn00011010", "LDS $N, MACL", ALL},
+    {"0100nnnn00101010", "LDS $N, PR", ALL},
+    {"0100nnnn01011010", "LDS $N, FPUL", SH3E | SH4 | SH4A},
+    {"0100nnnn01101010", "LDS $N, FPSCR", SH3E | SH4 | SH4A},
+    {"0100nnnn01101010", "LDS $N, DSR", SH3DSP | SHDSP},
+    {"0100nnnn01111010", "LDS $N, A0", SH3DSP | SHDSP},
+    {"0100nnnn10001010", "LDS $N, X0", SH3DSP | SHDSP},
+    {"0100nnnn10011010", "LDS $N, X1", SH3DSP | SHDSP},
+    {"0100nnnn10101010", "LDS $N, Y0", SH3DSP | SHDSP},
+    {"0100nnnn10111010", "LDS $N, Y1", SH3DSP | SHDSP},
+    {"0100nnnn00001010", "LDS $N, MACH ", SH4 | SH4A},
+    {"0100nnnn00000110", "LDS.L @$N+, MACH", ALL},
+    {"0100nnnn00010110", "LDS.L @$N+, MACL", ALL},
+    {"0100nnnn00100110", "LDS.L @$N+, PR", ALL},
+    {"0100nnnn01010110", "LDS.L @+$N, FPUL", SH3E},
+    {"0100nnnn01100110", "LDS.L @+$N, FPSCR", SH3E},
+    {"0100nnnn01100110", "LDS.L @$N+, DSR", SH3DSP | SHDSP},
+    {"0100nnnn01110110", "LDS.L @$N+, A0", SH3DSP | SHDSP},
+    {"0100nnnn10000110", "LDS.L @$N+, X0", SH3DSP | SHDSP},
+    {"0100nnnn10010110", "LDS.L @$N+, X1", SH3DSP | SHDSP},
+    {"0100nnnn10100110", "LDS.L @$N+, Y0", SH3DSP | SHDSP},
+    {"0100nnnn10110110", "LDS.L @$N+, Y1", SH3DSP | SHDSP},
+    {"0100nnnn01010110", "LDS.L @$N+, FPUL", SH4 | SH4A},
+    {"0100nnnn01100110", "LDS.L @$N+, FPSCR", SH4 | SH4A},
+    {"0000000000111000", "LDTLB", SH3 | SH3E | SH3DSP | SH4 | SH4A},
+    {"0000nnnnmmmm1111", "MAC.L @$M+, @$N+", SH2 | SH4 | SH4A | SHDSP},
+    {"0000nnnnmmmm1111", "MAC.L $M, $N", SH3 | SH3E | SH3DSP},
+    {"0100nnnnmmmm1111", "MAC.W @$M+, @$N+", SH2 | SHDSP},
+    {"0100nnnnmmmm1111", "MAC.W $M, $N", SH3 | SH3E | SH3DSP},
+    {"0100nnnnmmmm1111", "MAC.W @$M+, @$N+ ", SH4 | SH4A},
+    {"0110nnnnmmmm0011", "MOV $M, $N", ALL},
+    {"1110nnnniiiiiiii", "MOV $I, $N", SH1 | SH2 | SH3},
+    {"1110nnnniiiiiiii", "MOV #$I, $N", SH3E | SH3DSP | SH4 | SH4A | SHDSP},
+    {"0010nnnnmmmm0000", "MOV.B $M, @$N", ALL},
+    {"0110nnnnmmmm0000", "MOV.B @$M, $N", ALL},
+    {"0010nnnnmmmm0100", "MOV.B $M, @-$N", ALL},
+    {"0110nnnnmmmm0100", "MOV.B @$M+, $N", ALL},
+    {"0000nnnnmmmm0100", "MOV.B $M, @(R0, $N)", ALL},
+    {"0000nnnnmmmm1100", "MOV.B @(R0, $M), $N", ALL},
+    {"11000100pppppppp", "MOV.B @($P, GBR), R0", ALL},
+    {"11000000pppppppp", "MOV.B R0, @($P, GBR)", ALL},
+    {"10000000mmmmssss", "MOV.B R0, @($S, $M)", ALL},
+    {"10000100mmmmssss", "MOV.B @($S, $M), R0", ALL},
+    {"0010nnnnmmmm0010", "MOV.L $M, @$N", ALL},
+    {"0110nnnnmmmm0010", "MOV.L @$M, $N", ALL},
+    {"0010nnnnmmmm0110", "MOV.L $M, @-$N", ALL},
+    {"0110nnnnmmmm0110", "MOV.L @$M+, $N", ALL},
+    {"0000nnnnmmmm0110", "MOV.L $M, @(R0, $N)", ALL},
+    {"0000nnnnmmmm1110", "MOV.L @(R0, $M), $N", ALL},
+    {"1101nnnnpppppppp", "MOV.L @($P, PC), $N", ALL},
+    {"11000110pppppppp", "MOV.L @($P, GBR), R0", ALL},
+    {"11000010pppppppp", "MOV.L R0, @($P, GBR)", ALL},
+    {"0001nnnnmmmmssss", "MOV.L $M, @($S, $N)", ALL},
+    {"0101nnnnmmmmssss", "MOV.L @($S, $N), $M", SH1 | SH2 | SH3 | SH3E | SH3DSP | SHDSP},
+    {"0101nnnnmmmmssss", "MOV.L @($S, $M), $N", SH4 | SH4A},
+    {"0010nnnnmmmm0001", "MOV.W $M, @$N", ALL},
+    {"0110nnnnmmmm0001", "MOV.W @$M, $N", ALL},
+    {"0010nnnnmmmm0101", "MOV.W $M, @-$N", ALL},
+    {"0110nnnnmmmm0101", "MOV.W @$M+, $N", ALL},
+    {"0000nnnnmmmm0101", "MOV.W $M, @(R0, $N)", ALL},
+    {"0000nnnnmmmm1101", "MOV.W @(R0, $M), $N", ALL},
+    {"1001nnnnpppppppp", "MOV.W @($P, PC), $N", ALL},
+    {"11000101pppppppp", "MOV.W @($P, GBR), R0", ALL},
+    {"11000001pppppppp", "MOV.W R0, @($P, GBR)", ALL},
+    {"10000001mmmmssss", "MOV.W R0, @($S, $M)", ALL},
+    {"10000101mmmmssss", "MOV.W @($S, $M), R0", ALL},
+    {"11000111pppppppp", "MOVA @($P, PC), R0", ALL},
+    {"0000nnnn11000011", "MOVCA.L R0, @$N", SH4 | SH4A},
+    {"0000nnnn01110011", "MOVCO.L R0, @$N", SH4A},
+    {"0000nnnn01100011", "MOVLI.L @$N, R0", SH4A},
+    {"11110122qqqq0010", "MOVS.L @-$2, $1", SH3DSP | SHDSP},
+    // Was "MOVS.L @2, ..." before the decode tables, printing a literal "@2"
+    // instead of the As register; now renders like the other MOVS forms.
+    {"11110122qqqq0110", "MOVS.L @$2, $1", SH3DSP | SHDSP},
+    {"11110122qqqq1010", "MOVS.L @$2+, $1", SH3DSP | SHDSP},
+    {"11110122qqqq1110", "MOVS.L @$2+ Ix, $1", SH3DSP | SHDSP},
+    {"11110122qqqq0011", "MOVS.L $1, @-$2", SH3DSP | SHDSP},
+    {"11110122qqqq0111", "MOVS.L $1, @$2", SH3DSP | SHDSP},
+    {"11110122qqqq1011", "MOVS.L $1, @$2+", SH3DSP | SHDSP},
+    {"11110122qqqq1111", "MOVS.L $1, @$2+ Ix", SH3DSP | SHDSP},
+    {"11110122qqqq0000", "MOVS.W @-$2, $1", SH3DSP | SHDSP},
+    {"11110122qqqq0100", "MOVS.W @$2, $1", SH3DSP | SHDSP},
+    {"11110122qqqq1000", "MOVS.W @$2+, $1", SH3DSP | SHDSP},
+    {"11110122qqqq1100", "MOVS.W @$2+ Ix, $1", SH3DSP | SHDSP},
+    {"11110122qqqq0001", "MOVS.W $1, @-$2", SH3DSP | SHDSP},
+    {"11110122qqqq0101", "MOVS.W $1, @$2", SH3DSP | SHDSP},
+    {"11110122qqqq1001", "MOVS.W $1, @$2+", SH3DSP | SHDSP},
+    {"11110122qqqq1101", "MOVS.W $1, @$2+ Ix", SH3DSP | SHDSP},
+    {"0000nnnn00101001", "MOVT $N", ALL},
+    {"0100nnnn10101001", "MOVUA.L @$N, R0", SH4A},
+    {"0100nnnn11101001", "MOVUA.L @$N+, R0", SH4A},
+    {"0000nnnnmmmm0111", "MUL.L $M, $N", SH2 | SH3 | SH3E | SH3DSP | SH4 | SH4A | SHDSP},
+    {"0010nnnnmmmm1111", "MULS.W $M, $N", ALL},
+    {"0010nnnnmmmm1110", "MULU.W $M, $N", ALL},
+    {"0110nnnnmmmm1011", "NEG $M, $N", ALL},
+    {"0110nnnnmmmm1010", "NEGC $M, $N", ALL},
+    {"0000000000001001", "NOP", ALL},
+    {"0110nnnnmmmm0111", "NOT $M, $N", ALL},
+    {"0000nnnn10010011", "OCBI @$N", SH4 | SH4A},
+    {"0000nnnn10100011", "OCBP @$N", SH4 | SH4A},
+    {"0000nnnn10110011", "OCBWB @$N", SH4 | SH4A},
+    {"0010nnnnmmmm1011", "OR $M, $N", ALL},
+    {"11001011iiiiiiii", "OR $I, R0", SH1 | SH2 | SH3},
+    {"11001011iiiiiiii", "OR #$I, R0", SH3E | SH3DSP | SH4 | SH4A | SHDSP},
+    {"11001111iiiiiiii", "OR.B $I, @(R0, GBR)", SH1 | SH2 | SH3},
+    {"11001111iiiiiiii", "OR.B #$I, @(R0, GBR)", SH3E | SH3DSP | SH4 | SH4A | SHDSP},
+    {"0000nnnn10000011", "PREF @$N", SH3 | SH3E | SH3DSP | SH4 | SH4A},
+    {"0000nnnn11010011", "PREFI @$N", SH4A},
+    {"0100nnnn00100100", "ROTCL $N", ALL},
+    {"0100nnnn00100101", "ROTCR $N", ALL},
+    {"0100nnnn00000100", "ROTL $N", ALL},
+    {"0100nnnn00000101", "ROTR $N", ALL},
+    {"0000000000101011", "RTE", ALL},
+    {"0000000000001011", "RTS", ALL},
+    {"0100nnnn00010100", "SETRC $N", SH3 | SH3E | SH3DSP | SHDSP},
+    {"10000010iiiiiiii", "SETRC $I", SH3},
+    {"10000010iiiiiiii", "SETRC #$I", SH3E | SH3DSP | SHDSP},
+    {"0000000001011000", "SETS", SH3 | SH3E | SH3DSP | SH4 | SH4A},
+    {"0000000000011000", "SETT", ALL},
+    {"0100nnnnmmmm1100", "SHAD $M, $N", SH3 | SH3E | SH3DSP | SH4 | SH4A},
+    {"0100nnnn00100000", "SHAL $N", ALL},
+    {"0100nnnn00100001", "SHAR $N", ALL},
+    {"0100nnnnmmmm1101", "SHLD $M, $N", SH3 | SH3E | SH3DSP | SH4 | SH4A},
+    {"0100nnnn00000000", "SHLL $N", ALL},
+    {"0100nnnn00101000", "SHLL16 $N", ALL},
+    {"0100nnnn00001000", "SHLL2 $N", ALL},
+    {"0100nnnn00011000", "SHLL8 $N", ALL},
+    {"0100nnnn00000001", "SHLR $N", SH4 | SH4A},
+    {"0100nnnn00101001", "SHLR16 $N", SH4 | SH4A},
+    {"0100nnnn00001001", "SHLR2 $N", SH4 | SH4A},
+    {"0100nnnn00011001", "SHLR8 $N", SH4 | SH4A},
+    {"0100nnnn00000001", "SHRL $N", SH1 | SH2 | SH3 | SH3E | SH3DSP | SHDSP},
+    {"0100nnnn00101001", "SHRL16 $N", SH1 | SH2 | SH3 | SH3E | SH3DSP | SHDSP},
+    {"0100nnnn00001001", "SHRL2 $N", SH1 | SH2 | SH3 | SH3E | SH3DSP | SHDSP},
+    {"0100nnnn00011001", "SHRL8 $N", SH1 | SH2 | SH3 | SH3E | SH3DSP | SHDSP},
+    {"0000000000011011", "SLEEP", ALL},
+    {"0000nnnn00000010", "STC SR, $N", ALL},
+    {"0000nnnn00010010", "STC GBR, $N", ALL},
+    {"0000nnnn00100010", "STC VBR, $N", ALL},
+    {"0000nnnn00110010", "STC SSR, $N", SH3 | SH3E | SH3DSP | SH4 | SH4A},
+    {"0000nnnn01000010", "STC SPC, $N", SH3 | SH3E | SH3DSP | SH4 | SH4A},
+    {"0000nnnn10000010", "STC R0_BANK, $N", SH3 | SH3E | SH3DSP | SH4 | SH4A},
+    {"0000nnnn10010010", "STC R1_BANK, $N", SH3 | SH3E | SH3DSP | SH4 | SH4A},
+    {"0000nnnn10100010", "STC R2_BANK, $N", SH3 | SH3E | SH3DSP | SH4 | SH4A},
+    {"0000nnnn10110010", "STC R3_BANK, $N", SH3 | SH3E | SH3DSP | SH4 | SH4A},
+    {"0000nnnn11000010", "STC R4_BANK, $N", SH3 | SH3E | SH3DSP | SH4 | SH4A},
+    {"0000nnnn11010010", "STC R5_BANK, $N", SH3 | SH3E | SH3DSP | SH4 | SH4A},
+    {"0000nnnn11100010", "STC R6_BANK, $N", SH3 | SH3E | SH3DSP | SH4 | SH4A},
+    {"0000nnnn11110010", "STC R7_BANK, $N", SH3 | SH3E | SH3DSP | SH4 | SH4A},
+    {"0000nnnn01010010", "STC MOD, $N", SH3DSP | SHDSP},
+    {"0000nnnn01110010", "STC RE, $N", SH3DSP | SHDSP},
+    {"0000nnnn01100010", "STC RS, $N", SH3DSP | SHDSP},
+    {"0000nnnn11111010", "STC DBR, $N", SH4 | SH4A},
+    {"0100nnnn00000011", "STC.L SR, @-$N", ALL},
+    {"0100nnnn00010011", "STC.L GBR, @-$N", ALL},
+    {"0100nnnn00100011", "STC.L VBR, @-$N", ALL},
+    {"0100nnnn00110011", "STC.L SSR, @-$N", SH3 | SH3E | SH3DSP | SH4 | SH4A},
+    {"0100nnnn01000011", "STC.L SPC, @-$N", SH3 | SH3E | SH3DSP | SH4 | SH4A},
+    {"0100nnnn10000011", "STC.L R0_BANK, @-$N", SH3 | SH3E | SH3DSP | SH4 | SH4A},
+    {"0100nnnn10010011", "STC.L R1_BANK, @-$N", SH3 | SH3E | SH3DSP | SH4 | SH4A},
+    {"0100nnnn10100011", "STC.L R2_BANK, @-$N", SH3 | SH3E | SH3DSP | SH4 | SH4A},
+    {"0100nnnn10110011", "STC.L R3_BANK, @-$N", SH3 | SH3E | SH3DSP | SH4 | SH4A},
+    {"0100nnnn11000011", "STC.L R4_BANK, @-$N", SH3 | SH3E | SH3DSP | SH4 | SH4A},
+    {"0100nnnn11010011", "STC.L R5_BANK, @-$N", SH3 | SH3E | SH3DSP | SH4 | SH4A},
+    {"0100nnnn11100011", "STC.L R6_BANK, @-$N", SH3 | SH3E | SH3DSP | SH4 | SH4A},
+    {"0100nnnn11110011", "STC.L R7_BANK, @-$N", SH3 | SH3E | SH3DSP | SH4 | SH4A},
+    {"0100nnnn01010011", "STC.L MOD, @-$N", SH3DSP | SHDSP},
+    {"0100nnnn01110011", "STC.L RE, @-$N", SH3DSP | SHDSP},
+    {"0100nnnn01100011", "STC.L RS, @-$N", SH3DSP | SHDSP},
+    {"0100nnnn11110010", "STC.L DBR, @-$N", SH4 | SH4A},
+    {"0000nnnn00001010", "STS MACH, $N", ALL},
+    {"0000nnnn00011010", "STS MACL, $N", ALL},
+    {"0000nnnn00101010", "STS PR, $N", ALL},
+    {"0000nnnn01011010", "STS FPUL, $N", SH3E | SH4 | SH4A},
+    {"0000nnnn01101010", "STS FPSCR, $N", SH3E | SH4 | SH4A},
+    {"0000nnnn01101010", "STS DSR, $N", SH3DSP | SHDSP},
+    {"0000nnnn01111010", "STS A0, $N", SH3DSP | SHDSP},
+    {"0000nnnn10001010", "STS X0, $N", SH3DSP | SHDSP},
+    {"0000nnnn10011010", "STS X1, $N", SH3DSP | SHDSP},
+    {"0000nnnn10101010", "STS Y0, $N", SH3DSP | SHDSP},
+    {"0000nnnn10111010", "STS Y1, $N", SH3DSP | SHDSP},
+    {"0100nnnn00000010", "STS.L MACH, @-$N", ALL},
+    {"0100nnnn00010010", "STS.L MACL, @-$N", ALL},
+    {"0100nnnn00100010", "STS.L PR, @-$N", ALL},
+    {"0100nnnn01010010", "STS.L FPUL, @-$N", SH3E | SH4 | SH4A},
+    {"0100nnnn01100010", "STS.L FPSCR, @-$N", SH3E | SH4 | SH4A},
+    {"0100nnnn01100010", "STS.L DSR, @-$N", SH3DSP | SHDSP},
+    {"0100nnnn01110010", "STS.L A0, @-$N", SH3DSP | SHDSP},
+    {"0100nnnn10000010", "STS.L X0, @-$N", SH3DSP | SHDSP},
+    {"0100nnnn10010010", "STS.L X1, @-$N", SH3DSP | SHDSP},
+    {"0100nnnn10100010", "STS.L Y0, @-$N", SH3DSP | SHDSP},
+    {"0100nnnn10110010", "STS.L Y1, @-$N", SH3DSP | SHDSP},
+    {"0011nnnnmmmm1000", "SUB $M, $N", ALL},
+    {"0011nnnnmmmm1010", "SUBC $M, $N", ALL},
+    {"0011nnnnmmmm1011", "SUBV $M, $N", ALL},
+    {"0110nnnnmmmm1000", "SWAP.B $M, $N", ALL},
+    {"0110nnnnmmmm1001", "SWAP.W $M, $N", ALL},
+    {"0000000010101011", "SYNCO", SH4A},
+    {"0100nnnn00011011", "TAS.B $N", SH1 | SH2 | SHDSP},
+    {"0100nnnn00011011", "TAS.B @$N", SH3 | SH3E | SH3DSP | SH4 | SH4A},
+    {"11000011iiiiiiii", "TRAPA $I", SH1 | SH2 | SH3},
+    {"11000011iiiiiiii", "TRAPA #$I", SH3E | SH3DSP | SH4 | SH4A | SHDSP},
+    {"0010nnnnmmmm1000", "TST $M, $N", ALL},
+    {"11001000iiiiiiii", "TST $I, R0", SH1 | SH2 | SH3},
+    {"11001000iiiiiiii", "TST #$I, R0", SH3E | SH3DSP | SH4 | SH4A | SHDSP},
+    {"11001100iiiiiiii", "TST.B $I, @(R0, GBR)", SH1 | SH2 | SH3},
+    {"11001100iiiiiiii", "TST.B #$I, @(R0, GBR)", SH3E | SH3DSP | SH4 | SH4A | SHDSP},
+    {"0010nnnnmmmm1010", "XOR $M, $N", ALL},
+    {"11001010iiiiiiii", "XOR $I, R0", SH1 | SH2 | SH3},
+    {"11001010iiiiiiii", "XOR #$I, R0", SH3E | SH3DSP | SH4 | SH4A | SHDSP},
+    {"11001110iiiiiiii", "XOR.B $I, @(R0, GBR)", SH1 | SH2 | SH3},
+    {"11001110iiiiiiii", "XOR.B #$I, @(R0, GBR)", SH3E | SH3DSP | SH4 | SH4A | SHDSP},
+    {"0010nnnnmmmm1101", "XTRCT $M, $N", ALL},
+};
+
+static constexpr Operand operandLetter(char letter) {
+    switch (letter) {
+        case 'N': return Operand::Rn;
+        case 'M': return Operand::Rm;
+        case 'W': return Operand::FRn;
+        case 'X': return Operand::FRm;
+        case 'Q': return Operand::DRn;
+        case 'Z': return Operand::DRm;
+        case 'K': return Operand::XDn;
+        case 'L': return Operand::XDm;
+        case 'C': return Operand::FVn;
+        case 'V': return Operand::FVm;
+        case 'I': return Operand::Imm8;
+        case 'J': return Operand::Imm7;
+        case 'P': return Operand::Disp8;
+        case 'S': return Operand::Disp4;
+        case 'D': return Operand::Disp8Hex;
+        case 'F': return Operand::Disp12Hex;
+        case '1': return Operand::DspDs;
+        case '2': return Operand::DspAs;
+        case '3': return Operand::DspAx;
+        case '4': return Operand::DspDx;
+        case '5': return Operand::DspDa;
+        case '6': return Operand::DspAy;
+        case '7': return Operand::DspDy;
+        case '8': return Operand::DspDaY;
+        default: return Operand::None;
+    }
+}
+
+// Everything below is constant-initialized into read-only data: no code runs
+// before main() to build it, and a process only faults in the pages of the
+// tables it actually indexes, so a single-word lookup touches one page of
+// one ISA's table.
+static constexpr auto Formats = compileFormats(Instructions, operandLetter);
+
+static constexpr DecodeTable SuperH1Index = buildDecodeTable(compilePatterns(Instructions, SH1));
+static constexpr DecodeTable SuperH2Index = buildDecodeTable(compilePatterns(Instructions, SH2));
+static constexpr DecodeTable SuperH3Index = buildDecodeTable(compilePatterns(Instructions, SH3));
+static constexpr DecodeTable SuperH3EIndex = buildDecodeTable(compilePatterns(Instructions, SH3E));
+static constexpr DecodeTable SuperH3DSPIndex = buildDecodeTable(compilePatterns(Instructions, SH3DSP));
+static constexpr DecodeTable SuperH4Index = buildDecodeTable(compilePatterns(Instructions, SH4));
+static constexpr DecodeTable SuperH4AIndex = buildDecodeTable(compilePatterns(Instructions, SH4A));
+static constexpr DecodeTable SuperHDSPIndex = buildDecodeTable(compilePatterns(Instructions, SHDSP));
+
+constinit const DecodeTable* const DecodeTables[IsaCount] = {
+    &SuperH1Index,
+    &SuperH2Index,
+    &SuperH3Index,
+    &SuperH3EIndex,
+    &SuperH3DSPIndex,
+    &SuperH4Index,
+    &SuperH4AIndex,
+    &SuperHDSPIndex
+};
+
+constinit const CompiledFormat* const InstructionFormats = Formats.data();
+
+size_t instructionCount() {
+    return std::size(Instructions);
+}
+
+const OpcodeEntry& instructionEntry(const uint16_t opcode) {
+    return Instructions[opcode];
+}
+
+static constexpr uint32_t RowsHash = [] {
+    uint32_t hash = 2166136261u;
+    const auto mix = [&](uint8_t byte) { hash = (hash ^ byte) * 16777619u; };
+    for (const OpcodeEntry& entry : Instructions) {
+        for (char c : entry.pattern) mix(static_cast<uint8_t>(c));
+        mix(0);
+        for (char c : entry.assembly) mix(static_cast<uint8_t>(c));
+        mix(0);
+        mix(entry.isas);
+    }
+    for (const CompiledFormat& format : Formats) {
+        for (uint8_t i = 0; i < format.count; ++i) {
+            for (char c : format.tokens[i].literal) mix(static_cast<uint8_t>(c));
+            mix(0);
+            mix(static_cast<uint8_t>(format.tokens[i].operand));
+        }
+        mix(0xFF);
+    }
+    return hash;
+}();
+
+// The decode tables are hashed at run time: 512K entries are too many to
+// fold at compile time without slowing the build noticeably.
+uint32_t decoderHash() {
+    static const uint32_t hash = [] {
+        uint32_t hash = RowsHash;
+        const auto mix = [&](uint8_t byte) { hash = (hash ^ byte) * 16777619u; };
+        for (const DecodeTable* table : DecodeTables) {
+            for (const uint16_t opcode : *table) {
+                mix(static_cast<uint8_t>(opcode));
+                mix(static_cast<uint8_t>(opcode >> 8));
+            }
+        }
+        const uint32_t formatter = formatterHash();
+        for (int shift = 0; shift < 32; shift += 8) mix(static_cast<uint8_t>(formatter >> shift));
+        return hash;
+    }();
+    return hash;
+}
@@ -0,0 +1,35 @@
+/*
+ * This code is licensed under the GNU AGPLv3
+ * Copyright (c) 2025 GokbakarE
+ * Date: 28-08-2025
+ */
+
+#pragma once
+#ifndef INSTRUCTIONTABLE_H
+#define INSTRUCTIONTABLE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include "DecodeTable.hpp"
+#include "Formatter.hpp"
+#include "SuperH.hpp"
+
+// Per-ISA views of the shared instruction table, indexed by ISA.
+extern const DecodeTable* const DecodeTables[IsaCount];
+
+// Compiled assembly templates, indexed by opcode.
+extern const CompiledFormat* const InstructionFormats;
+
+size_t instructionCount();
+const OpcodeEntry& instructionEntry(uint16_t opcode);
+
+// Hash of everything that decides the text of a word: the rows of the
+// instruction table, their compiled templates, every ISA's decode table (and
+// so the decode priority order) and the formatter's names. Identifies the
+// decoder that derived data such as a precomputed render table was generated
+// from. Computed on first use.
+uint32_t decoderHash();
+
+#endif
@@ -0,0 +1,309 @@
+/*
+ * This code is licensed under the GNU AGPLv3
+ * Copyright (c) 2025 GokbakarE
+ * Date: 28-08-2025
+ */
+
+#include "Listing.hpp"
+
+#include <algorithm>
+#include <array>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "TaskPool.hpp"
+
+static constexpr size_t BlockWords = 4096;
+
+// Bytes handed to printListing at a time when streaming a file or stream.
+static constexpr size_t StreamBlock = 1 << 20;
+
+static constexpr char HexDigits[] = "0123456789abcdef";
+
+// "xxxxxxxx: [xxxx] -> " plus the instruction and a newline.
+static constexpr size_t MaxLineText = 20 + MaxInsnText + 1;
+
+// Instructions per chunk handed to a worker thread, chunks per worker that
+// may be formatted ahead of the output, and the most chunks in flight for
+// any number of workers. Each chunk buffer takes ChunkWords * MaxLineText
+// bytes (about 1.1 MB), so the window never holds more than about 36 MB.
+static constexpr size_t ChunkWords = 1 << 14;
+static constexpr size_t ChunkWindow = 4;
+static constexpr size_t MaxChunksInFlight = 32;
+
+static char* formatLine(char* cursor, const uint16_t word, const DecodedInsn& insn, const ListingOptions& options,
+                        const std::optional<uint32_t> address, ThreadStats* counters) {
+    if (address) {
+        for (int shift = 28; shift >= 0; shift -= 4) *cursor++ = HexDigits[(*address >> shift) & 0xF];
+        cursor = std::copy_n(": ", 2, cursor);
+    }
+    *cursor++ = '[';
+    for (int shift = 12; shift >= 0; shift -= 4) *cursor++ = HexDigits[(word >> shift) & 0xF];
+    cursor = std::copy_n("] -> ", 5, cursor);
+    const char* const text = cursor;
+    if (options.renderTable) cursor += options.renderTable->render(word, options.isa, cursor);
+    else cursor += format(insn, options.isa, cursor);
+    // Mnemonics are upper case, so only the "word..." fallback starts with 'w'.
+    if (counters && *text == 'w') ++counters->fallbacks[static_cast<size_t>(options.isa)];
+    *cursor++ = '\n';
+    return cursor;
+}
+
+// Address of instruction index, if the listing has addresses.
+static std::optional<uint32_t> addressOf(const ListingOptions& options, size_t index) {
+    if (!options.address) return std::nullopt;
+    return static_cast<uint32_t>(*options.address + index * 2);
+}
+
+// The calling thread's --stats counters, or null when not counting.
+static ThreadStats* statsOf(const ListingOptions& options) {
+    return options.stats ? &options.stats->local() : nullptr;
+}
+
+// Loads the first count halfwords of bytes into words and, unless rendering
+// from a table or counting a histogram, decodes them into decoded.
+static void loadBlock(const std::span<const std::byte> bytes, const size_t count, const ListingOptions& options,
+                      uint16_t* words, DecodedInsn* decoded, ThreadStats* counters) {
+    {
+        const StageTimer timer(counters, StatStage::Load);
+        const TraceSpan span(options.tracer, "load", count);
+        loadHalfwords(bytes, options.endian, {words, count});
+    }
+    if (!options.renderTable && !options.histogram) {
+        const StageTimer timer(counters, StatStage::Decode);
+        const TraceSpan span(options.tracer, "decode", count);
+        decodeBatch({words, count}, options.isa, {decoded, count});
+    }
+    if (counters) {
+        counters->bytesRead += count * 2;
+        counters->instructions += count;
+    }
+}
+
+// Counts the first count instructions of bytes into options.histogram. The
+// counting is timed as decoding, which it replaces.
+static void countLines(const std::span<const std::byte> bytes, const size_t count, const ListingOptions& options) {
+    std::array<uint16_t, BlockWords> words;
+    ThreadStats* const counters = statsOf(options);
+
+    for (size_t start = 0; start < count; start += BlockWords) {
+        const size_t block = std::min(BlockWords, count - start);
+        loadBlock(bytes.subspan(start * 2), block, options, words.data(), nullptr, counters);
+
+        const StageTimer timer(counters, StatStage::Decode);
+        const TraceSpan span(options.tracer, "count", block);
+        options.histogram->count({words.data(), block});
+    }
+}
+
+// Formats the first count instructions of bytes into out, which must hold
+// count * MaxLineText characters, and returns the end of the text. With a
+// histogram, only counts them and writes nothing.
+static char* formatLines(const std::span<const std::byte> bytes, const size_t count, const ListingOptions& options,
+                         char* out) {
+    if (options.histogram) {
+        countLines(bytes, count, options);
+        return out;
+    }
+
+    std::array<uint16_t, BlockWords> words;
+    std::array<DecodedInsn, BlockWords> decoded;
+    ThreadStats* const counters = statsOf(options);
+
+    for (size_t start = 0; start < count; start += BlockWords) {
+        const size_t block = std::min(BlockWords, count - start);
+        loadBlock(bytes.subspan(start * 2), block, options, words.data(), decoded.data(), counters);
+
+        const StageTimer timer(counters, StatStage::Format);
+        const TraceSpan span(options.tracer, "format", block);
+        for (size_t i = 0; i < block; ++i)
+            out = formatLine(out, words[i], decoded[i], options, addressOf(options, start + i), counters);
+    }
+    return out;
+}
+
+// Cuts the listing into chunks of ChunkWords instructions that worker threads
+// format into chunk buffers while this thread writes finished buffers out in
+// address order, so the output matches a serial run. At most ChunkWindow
+// chunks per job, and MaxChunksInFlight in all, are in flight, which bounds
+// memory. When file is given, the pages of each chunk are released once it is
+// formatted. workers belongs to the whole listing, so the blocks of a stream
+// and the sections of an ELF file are all formatted by the same threads.
+static size_t printParallel(const std::span<const std::byte> bytes, const MappedFile* file,
+                            const ListingOptions& options, OutputWriter& out, WorkerPool& workers) {
+    const size_t total = std::min(bytes.size() / 2, options.limit);
+    const size_t chunkCount = (total + ChunkWords - 1) / ChunkWords;
+    const size_t window = std::min<size_t>(ChunkWindow * options.jobs, MaxChunksInFlight);
+
+    struct Slot {
+        std::unique_ptr<char[]> text;
+        size_t length = 0;
+        bool ready = false;
+    };
+    std::vector<Slot> slots(std::min(window, chunkCount));
+
+    std::mutex mutex;
+    std::condition_variable changed;
+    size_t claimed = 0;
+    size_t emitted = 0;
+    bool stopped = false;
+
+    const auto work = [&] {
+        for (;;) {
+            size_t chunk;
+            {
+                std::unique_lock lock(mutex);
+                changed.wait(lock, [&] { return stopped || claimed == chunkCount || claimed < emitted + window; });
+                if (stopped || claimed == chunkCount) return;
+                chunk = claimed++;
+            }
+
+            const size_t start = chunk * ChunkWords;
+            const size_t count = std::min(ChunkWords, total - start);
+            const auto chunkBytes = bytes.subspan(start * 2, count * 2);
+            ListingOptions chunkOptions = options;
+            chunkOptions.address = addressOf(options, start);
+
+            const TraceSpan span(options.tracer, "chunk", count);
+            Slot& slot = slots[chunk % slots.size()];
+            if (!slot.text && !options.histogram)
+                slot.text = std::make_unique_for_overwrite<char[]>(ChunkWords * MaxLineText);
+            slot.length = static_cast<size_t>(formatLines(chunkBytes, count, chunkOptions, slot.text.get()) - slot.text.get());
+            if (file) file->release(chunkBytes);
+
+            std::lock_guard lock(mutex);
+            slot.ready = true;
+            changed.notify_all();
+        }
+    };
+
+    workers.start(work);
+
+    try {
+        for (size_t chunk = 0; chunk < chunkCount; ++chunk) {
+            Slot& slot = slots[chunk % slots.size()];
+            {
+                const TraceSpan span(options.tracer, "wait for chunk");
+                std::unique_lock lock(mutex);
+                changed.wait(lock, [&] { return slot.ready; });
+            }
+            {
+                const TraceSpan span(options.tracer, "write chunk", slot.length);
+                out.write({slot.text.get(), slot.length});
+            }
+
+            std::lock_guard lock(mutex);
+            slot.ready = false;
+            ++emitted;
+            changed.notify_all();
+        }
+    } catch (...) {
+        {
+            std::lock_guard lock(mutex);
+            stopped = true;
+        }
+        changed.notify_all();
+        workers.wait();
+        throw;
+    }
+    workers.wait();
+    return total;
+}
+
+// printListing() of bytes with the worker pool of the whole listing.
+static size_t listBytes(const std::span<const std::byte> bytes, const ListingOptions& options, OutputWriter& out,
+                        WorkerPool& workers) {
+    const size_t total = std::min(bytes.size() / 2, options.limit);
+    if (options.jobs > 1 && total > ChunkWords) return printParallel(bytes, nullptr, options, out, workers);
+    if (options.histogram) {
+        countLines(bytes, total, options);
+        return total;
+    }
+
+    std::array<uint16_t, BlockWords> words;
+    std::array<DecodedInsn, BlockWords> decoded;
+    ThreadStats* const counters = statsOf(options);
+
+    for (size_t start = 0; start < total; start += BlockWords) {
+        const size_t count = std::min(BlockWords, total - start);
+        loadBlock(bytes.subspan(start * 2), count, options, words.data(), decoded.data(), counters);
+        const StageCounts written = counters ? counters->stage(StatStage::Write) : StageCounts{};
+
+        {
+            const StageTimer timer(counters, StatStage::Format);
+            const TraceSpan span(options.tracer, "format", count);
+            for (size_t i = 0; i < count; ++i) {
+                char* const line = out.reserve(MaxLineText);
+                const char* end = formatLine(line, words[i], decoded[i], options, addressOf(options, start + i), counters);
+                out.commit(static_cast<size_t>(end - line));
+            }
+        }
+        // Flushes inside reserve() are already counted as Write.
+        if (counters) counters->subtractNested(StatStage::Format, StatStage::Write, written);
+    }
+    return total;
+}
+
+size_t printListing(const std::span<const std::byte> bytes, const ListingOptions& options, OutputWriter& out) {
+    WorkerPool workers(options.jobs);
+    return listBytes(bytes, options, out, workers);
+}
+
+// Options for continuing a listing after written instructions.
+static ListingOptions advance(const ListingOptions& options, size_t written) {
+    ListingOptions next = options;
+    next.limit -= written;
+    if (next.address) *next.address += static_cast<uint32_t>(written * 2);
+    return next;
+}
+
+static size_t listFile(const MappedFile& file, const std::span<const std::byte> bytes, const ListingOptions& options,
+                       OutputWriter& out, WorkerPool& workers) {
+    if (options.jobs > 1) return printParallel(bytes, &file, options, out, workers);
+
+    size_t written = 0;
+    for (size_t start = 0; start + 1 < bytes.size() && written < options.limit; start += StreamBlock) {
+        const auto block = bytes.subspan(start, std::min(StreamBlock, bytes.size() - start));
+        written += listBytes(block, advance(options, written), out, workers);
+        file.release(block);
+    }
+    return written;
+}
+
+size_t printListing(const MappedFile& file, const std::span<const std::byte> bytes, const ListingOptions& options,
+                    OutputWriter& out) {
+    WorkerPool workers(options.jobs);
+    return listFile(file, bytes, options, out, workers);
+}
+
+size_t printListing(const ElfFile& elf, const std::span<const ElfSection* const> sections,
+                    const ListingOptions& options, OutputWriter& out) {
+    WorkerPool workers(options.jobs);
+    size_t written = 0;
+    for (const ElfSection* section : sections) {
+        ListingOptions sectionOptions = options;
+        sectionOptions.limit -= written;
+        written += listFile(elf.file(), elf.sectionData(*section), sectionOptions, out, workers);
+        if (options.histogram) options.histogram->closeSection(section->name);
+    }
+    return written;
+}
+
+size_t printListing(std::istream& in, const ListingOptions& options, OutputWriter& out) {
+    WorkerPool workers(options.jobs);
+    std::vector<std::byte> buffer(StreamBlock);
+    size_t carried = 0;
+    size_t written = 0;
+    while (written < options.limit && in) {
+        in.read(reinterpret_cast<char*>(buffer.data() + carried), static_cast<std::streamsize>(StreamBlock - carried));
+        const size_t filled = carried + static_cast<size_t>(in.gcount());
+
+        written += listBytes({buffer.data(), filled}, advance(options, written), out, workers);
+
+        carried = filled % 2;
+        if (carried) buffer[0] = buffer[filled - 1];
+    }
+    return written;
+}
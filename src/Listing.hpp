@@ -0,0 +1,69 @@
+/*
+ * This code is licensed under the GNU AGPLv3
+ * Copyright (c) 2025 GokbakarE
+ * Date: 28-08-2025
+ */
+
+#pragma once
+#ifndef LISTING_H
+#define LISTING_H
+
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <optional>
+#include <span>
+
+#include "ByteOrder.hpp"
+#include "ElfFile.hpp"
+#include "Histogram.hpp"
+#include "MappedFile.hpp"
+#include "OutputWriter.hpp"
+#include "RenderTable.hpp"
+#include "Stats.hpp"
+#include "Trace.hpp"
+#include "SuperH.hpp"
+
+struct ListingOptions {
+    ISA isa = ISA::SuperH4;
+    Endian endian = Endian::Big;
+    // Maximum number of instructions to write.
+    size_t limit = 50;
+    // Load address of the first instruction. When given, each line is
+    // prefixed with the address of its instruction as "xxxxxxxx: ".
+    std::optional<uint32_t> address;
+    // Worker threads formatting the listing. The output is the same for any
+    // number of jobs.
+    unsigned jobs = 1;
+    // Precomputed texts to render from instead of decoding; same output.
+    const RenderTable* renderTable = nullptr;
+    // Counters to update for --stats, or null.
+    Stats* stats = nullptr;
+    // Timeline to record stage spans into for --trace, or null.
+    Tracer* tracer = nullptr;
+    // When set, instructions are counted into it for --histogram instead of
+    // being written; nothing goes to the output.
+    Histogram* histogram = nullptr;
+};
+
+// Decodes bytes as halfwords and writes one "[xxxx] -> text" line per
+// instruction, stopping after options.limit instructions. Returns how many
+// instructions were written. A trailing odd byte is ignored.
+size_t printListing(std::span<const std::byte> bytes, const ListingOptions& options, OutputWriter& out);
+
+// Same as above for bytes lying inside file, which is walked in fixed-size
+// blocks, releasing each block's pages once it is written so the resident set
+// stays bounded however large the file is.
+size_t printListing(const MappedFile& file, std::span<const std::byte> bytes, const ListingOptions& options, OutputWriter& out);
+
+// Same as above for a stream such as standard input, read in fixed-size
+// blocks until end of stream or options.limit.
+size_t printListing(std::istream& in, const ListingOptions& options, OutputWriter& out);
+
+// Lists the given sections of elf one after another, options.limit counting
+// instructions across all of them. A histogram gets one section per section
+// of elf.
+size_t printListing(const ElfFile& elf, std::span<const ElfSection* const> sections, const ListingOptions& options,
+                    OutputWriter& out);
+
+#endif
@@ -0,0 +1,74 @@
+/*
+ * This code is licensed under the GNU AGPLv3
+ * Copyright (c) 2025 GokbakarE
+ * Date: 28-08-2025
+ */
+
+#include "MappedFile.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Windows up to this size are read page by page as they are touched; larger
+// ones are streamed front to back and benefit from kernel readahead.
+static constexpr size_t RandomAccessWindow = 1 << 20;
+
+MappedFile::MappedFile(const std::string& path) : MappedFile(path, 0, std::nullopt) {}
+
+MappedFile::MappedFile(const std::string& path, const uint64_t offset, const std::optional<uint64_t> length) {
+    const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+        throw std::runtime_error("Failed to open file: " + path + " (" + std::strerror(errno) + ")");
+
+    struct stat info {};
+    if (::fstat(fd, &info) != 0) {
+        const int error = errno;
+        ::close(fd);
+        throw std::runtime_error("Failed to stat file: " + path + " (" + std::strerror(error) + ")");
+    }
+
+    const auto fileSize = static_cast<uint64_t>(info.st_size);
+    if (offset > fileSize) {
+        ::close(fd);
+        throw std::runtime_error("Offset is past the end of file: " + path);
+    }
+    size_ = static_cast<size_t>(std::min(length.value_or(fileSize - offset), fileSize - offset));
+
+    if (size_ > 0) {
+        const auto pageSize = static_cast<uint64_t>(::sysconf(_SC_PAGESIZE));
+        const uint64_t mapOffset = offset - offset % pageSize;
+        const size_t lead = static_cast<size_t>(offset - mapOffset);
+        mappingSize_ = lead + size_;
+
+        mapping_ = ::mmap(nullptr, mappingSize_, PROT_READ, MAP_PRIVATE, fd, static_cast<off_t>(mapOffset));
+        if (mapping_ == MAP_FAILED) {
+            const int error = errno;
+            mapping_ = nullptr;
+            ::close(fd);
+            throw std::runtime_error("Failed to map file: " + path + " (" + std::strerror(error) + ")");
+        }
+        ::madvise(mapping_, mappingSize_, size_ <= RandomAccessWindow ? MADV_RANDOM : MADV_SEQUENTIAL);
+        data_ = static_cast<const std::byte*>(mapping_) + lead;
+    }
+    ::close(fd);
+}
+
+MappedFile::~MappedFile() {
+    if (mapping_) ::munmap(mapping_, mappingSize_);
+}
+
+void MappedFile::release(const std::span<const std::byte> consumed) const {
+    const auto pageSize = static_cast<uintptr_t>(::sysconf(_SC_PAGESIZE));
+    const auto begin = reinterpret_cast<uintptr_t>(consumed.data());
+    const auto end = begin + consumed.size();
+    const uintptr_t first = (begin + pageSize - 1) / pageSize * pageSize;
+    const uintptr_t last = end / pageSize * pageSize;
+    if (first < last) ::madvise(reinterpret_cast<void*>(first), last - first, MADV_DONTNEED);
+}
@@ -0,0 +1,48 @@
+/*
+ * This code is licensed under the GNU AGPLv3
+ * Copyright (c) 2025 GokbakarE
+ * Date: 28-08-2025
+ */
+
+#pragma once
+#ifndef MAPPEDFILE_H
+#define MAPPEDFILE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+
+// Read-only memory mapping of a file, or of a window of it. Pages are only
+// read from disk when they are first touched.
+class MappedFile {
+public:
+    explicit MappedFile(const std::string& path);
+
+    // Maps length bytes starting at offset, or everything up to the end of
+    // the file when length is not given. Only the pages of the window are
+    // mapped, so a small window of a huge dump costs only its own I/O.
+    MappedFile(const std::string& path, uint64_t offset, std::optional<uint64_t> length);
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    std::span<const std::byte> bytes() const { return {data_, size_}; }
+    size_t size() const { return size_; }
+
+    // Drops the resident pages lying entirely inside consumed, a range of
+    // bytes() that will not be read again, so that walking a large file
+    // front to back keeps a bounded resident set. Touching them again
+    // re-reads them from the file.
+    void release(std::span<const std::byte> consumed) const;
+
+private:
+    void* mapping_ = nullptr;
+    size_t mappingSize_ = 0;
+    const std::byte* data_ = nullptr;
+    size_t size_ = 0;
+};
+
+#endif
@@ -0,0 +1,160 @@
+/*
+ * This code is licensed under the GNU AGPLv3
+ * Copyright (c) 2025 GokbakarE
+ * Date: 28-08-2025
+ */
+
+#include "OutputWriter.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+#include <string>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+std::optional<OutputMode> outputModeFromName(std::string_view name) {
+    if (name == "stream") return OutputMode::Stream;
+    if (name == "write") return OutputMode::Write;
+    if (name == "splice") return OutputMode::Splice;
+    if (name == "auto") return OutputMode::Auto;
+    return std::nullopt;
+}
+
+static bool isPipe(int fd) {
+    struct stat info {};
+    return ::fstat(fd, &info) == 0 && S_ISFIFO(info.st_mode);
+}
+
+// Grows the pipe towards capacity and returns the size it ended up with, or
+// 0 where pipes cannot be spliced into.
+static size_t pipeSize(int fd, size_t capacity) {
+#if defined(__linux__)
+    ::fcntl(fd, F_SETPIPE_SZ, static_cast<int>(capacity));
+    const int size = ::fcntl(fd, F_GETPIPE_SZ);
+    return size > 0 ? static_cast<size_t>(size) : 0;
+#else
+    (void)fd;
+    (void)capacity;
+    return 0;
+#endif
+}
+
+OutputWriter::OutputWriter(const int fd, const OutputMode mode, const size_t capacity) : mode_(mode), fd_(fd) {
+    const bool pipe = isPipe(fd);
+    if (mode_ == OutputMode::Auto) mode_ = pipe ? OutputMode::Splice : OutputMode::Write;
+    if (mode_ == OutputMode::Stream || (mode_ == OutputMode::Splice && !pipe)) mode_ = OutputMode::Write;
+
+    size_t halfSize = 0;
+    if (mode_ == OutputMode::Splice) halfSize = pipeSize(fd, capacity);
+    if (halfSize == 0) mode_ = OutputMode::Write;
+
+    if (mode_ != OutputMode::Splice) {
+        allocate(capacity);
+        return;
+    }
+
+    allocate(halfSize * 2);
+    capacity_ = halfSize;
+}
+
+OutputWriter::OutputWriter(std::ostream& out, const size_t capacity) : mode_(OutputMode::Stream), stream_(&out) {
+    allocate(capacity);
+}
+
+OutputWriter::~OutputWriter() {
+    try {
+        flush();
+    } catch (const std::exception&) {
+    }
+    if (allocation_) ::munmap(allocation_, allocationSize_);
+}
+
+// Page-aligned, so that spliced buffers cover whole pages.
+void OutputWriter::allocate(const size_t capacity) {
+    void* memory = ::mmap(nullptr, capacity, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (memory == MAP_FAILED) throw std::bad_alloc();
+
+    allocation_ = static_cast<char*>(memory);
+    allocationSize_ = capacity;
+    buffer_ = allocation_;
+    capacity_ = capacity;
+}
+
+void OutputWriter::write(std::string_view text) {
+    while (!text.empty()) {
+        const size_t length = std::min(text.size(), capacity_);
+        std::memcpy(reserve(length), text.data(), length);
+        commit(length);
+        text.remove_prefix(length);
+    }
+}
+
+void OutputWriter::flush() {
+    if (used_ == 0) return;
+
+    const StageTimer timer(stats_ ? &stats_->local() : nullptr, StatStage::Write);
+    const TraceSpan span(tracer_, "flush", used_);
+    const size_t length = used_;
+    used_ = 0;
+    switch (mode_) {
+        case OutputMode::Stream:
+            stream_->write(buffer_, static_cast<std::streamsize>(length));
+            stream_->flush();
+            if (!*stream_) throw std::runtime_error("Failed to write output");
+            break;
+        case OutputMode::Splice:
+            // Only full halves are spliced; a partial one is copied so that
+            // the half-swapping argument above keeps holding.
+            if (length < capacity_) {
+                writeAll(buffer_, length);
+                break;
+            }
+            spliceAll(buffer_, length);
+            buffer_ = buffer_ == allocation_ ? allocation_ + capacity_ : allocation_;
+            break;
+        default:
+            writeAll(buffer_, length);
+            break;
+    }
+}
+
+void OutputWriter::writeAll(const char* data, size_t length) {
+    while (length > 0) {
+        const ssize_t written = ::write(fd_, data, length);
+        if (written < 0) {
+            if (errno == EINTR) continue;
+            throw std::runtime_error(std::string("Failed to write output (") + std::strerror(errno) + ")");
+        }
+        data += written;
+        length -= static_cast<size_t>(written);
+    }
+}
+
+void OutputWriter::spliceAll(const char* data, size_t length) {
+#if defined(__linux__)
+    while (length > 0) {
+        iovec chunk{const_cast<char*>(data), length};
+        const ssize_t written = ::vmsplice(fd_, &chunk, 1, 0);
+        if (written < 0) {
+            if (errno == EINTR) continue;
+            if (errno == EINVAL || errno == ENOSYS) {
+                mode_ = OutputMode::Write;
+                writeAll(data, length);
+                return;
+            }
+            throw std::runtime_error(std::string("Failed to write output (") + std::strerror(errno) + ")");
+        }
+        data += written;
+        length -= static_cast<size_t>(written);
+    }
+#else
+    writeAll(data, length);
+#endif
+}
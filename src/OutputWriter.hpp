@@ -0,0 +1,90 @@
+/*
+ * This code is licensed under the GNU AGPLv3
+ * Copyright (c) 2025 GokbakarE
+ * Date: 28-08-2025
+ */
+
+#pragma once
+#ifndef OUTPUTWRITER_H
+#define OUTPUTWRITER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <ostream>
+#include <string_view>
+
+#include "Stats.hpp"
+#include "Trace.hpp"
+
+// How an OutputWriter hands its buffer to the destination.
+enum class OutputMode : uint8_t {
+    Stream,  // std::ostream::write, one call per full buffer
+    Write,   // write(2) on a file descriptor
+    Splice,  // vmsplice(2) into a pipe; falls back to Write for anything else
+    Auto     // Splice when the descriptor is a pipe, Write otherwise
+};
+
+// Parses "stream", "write", "splice" or "auto".
+std::optional<OutputMode> outputModeFromName(std::string_view name);
+
+// Buffered text sink. Callers format straight into the buffer through
+// reserve()/commit(), and the buffer is only handed on when it fills up or
+// on flush(), so a listing costs a handful of large writes instead of one
+// stream insertion per field.
+class OutputWriter {
+public:
+    static constexpr size_t DefaultCapacity = 1 << 20;
+
+    explicit OutputWriter(int fd, OutputMode mode = OutputMode::Auto, size_t capacity = DefaultCapacity);
+    explicit OutputWriter(std::ostream& out, size_t capacity = DefaultCapacity);
+
+    // Flushes what is left, ignoring errors; call flush() first to see them.
+    ~OutputWriter();
+
+    OutputWriter(const OutputWriter&) = delete;
+    OutputWriter& operator=(const OutputWriter&) = delete;
+
+    // Returns room for at least length characters, length being at most the
+    // buffer capacity. Only the characters later passed to commit() are kept.
+    char* reserve(size_t length) {
+        if (capacity_ - used_ < length) flush();
+        return buffer_ + used_;
+    }
+
+    void commit(size_t length) { used_ += length; }
+
+    void write(std::string_view text);
+
+    // Hands the buffered text on. Throws std::runtime_error when the
+    // destination refuses it.
+    void flush();
+
+    // Counts the time spent handing text on as the Write stage of stats.
+    void trackStats(Stats* stats) { stats_ = stats; }
+
+    // Records every flush as a span of tracer.
+    void traceFlushes(Tracer* tracer) { tracer_ = tracer; }
+
+private:
+    void allocate(size_t capacity);
+    void writeAll(const char* data, size_t length);
+    void spliceAll(const char* data, size_t length);
+
+    OutputMode mode_;
+    int fd_ = -1;
+    std::ostream* stream_ = nullptr;
+
+    // Splice mode alternates between two pipe-sized halves of one allocation:
+    // a half spliced into the pipe is only reused after the other half has
+    // filled the pipe behind it, which means the reader has consumed it.
+    char* allocation_ = nullptr;
+    size_t allocationSize_ = 0;
+    char* buffer_ = nullptr;
+    size_t capacity_ = 0;
+    size_t used_ = 0;
+    Stats* stats_ = nullptr;
+    Tracer* tracer_ = nullptr;
+};
+
+#endif
@@ -0,0 +1,119 @@
+/*
+ * This code is licensed under the GNU AGPLv3
+ * Copyright (c) 2025 GokbakarE
+ * Date: 28-08-2025
+ */
+
+#include "PerfCounters.hpp"
+
+#include <cerrno>
+#include <cstring>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+std::string_view perfEventName(const PerfEvent event) {
+    static constexpr std::string_view Names[PerfEventCount] = {
+        "cycles", "instructions", "branch-misses", "L1d-misses", "LLC-misses"
+    };
+    return Names[static_cast<size_t>(event)];
+}
+
+#if defined(__linux__)
+
+static constexpr uint64_t cacheEvent(uint64_t cache, uint64_t operation, uint64_t result) {
+    return cache | operation << 8 | result << 16;
+}
+
+static constexpr struct {
+    uint32_t type;
+    uint64_t config;
+} EventConfigs[PerfEventCount] = {
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+    {PERF_TYPE_HW_CACHE,
+     cacheEvent(PERF_COUNT_HW_CACHE_L1D, PERF_COUNT_HW_CACHE_OP_READ, PERF_COUNT_HW_CACHE_RESULT_MISS)},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES}
+};
+
+PerfCounters::PerfCounters() {
+    fds_.fill(-1);
+    for (size_t i = 0; i < PerfEventCount; ++i) {
+        perf_event_attr attr{};
+        attr.size = sizeof attr;
+        attr.type = EventConfigs[i].type;
+        attr.config = EventConfigs[i].config;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING |
+                           PERF_FORMAT_ID;
+        // The leader starts disabled and enables the whole group at once.
+        attr.disabled = i == 0;
+
+        const long fd = ::syscall(SYS_perf_event_open, &attr, 0, -1, i == 0 ? -1 : fds_[0], PERF_FLAG_FD_CLOEXEC);
+        if (fd >= 0) {
+            fds_[i] = static_cast<int>(fd);
+            continue;
+        }
+        // A missing event only leaves that event out, but no descriptors
+        // left would silently thin out the group, so that fails it whole.
+        const int error = errno;
+        outOfFiles_ = error == EMFILE || error == ENFILE;
+        if (i == 0 || outOfFiles_) {
+            error_ = std::string("perf_event_open failed (") + std::strerror(error) + ")";
+            for (int& opened : fds_) {
+                if (opened >= 0) ::close(opened);
+                opened = -1;
+            }
+            return;
+        }
+    }
+    ::ioctl(fds_[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ::ioctl(fds_[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+}
+
+PerfCounters::~PerfCounters() {
+    for (const int fd : fds_)
+        if (fd >= 0) ::close(fd);
+}
+
+PerfValues PerfCounters::read() const {
+    PerfValues values{};
+    if (!available()) return values;
+
+    // nr, time_enabled, time_running, then (value, id) per group member in
+    // the order the members were opened.
+    uint64_t buffer[3 + 2 * PerfEventCount];
+    if (::read(fds_[0], buffer, sizeof buffer) < static_cast<ssize_t>(3 * sizeof(uint64_t))) return values;
+
+    const uint64_t enabled = buffer[1];
+    const uint64_t running = buffer[2];
+    size_t member = 0;
+    for (size_t i = 0; i < PerfEventCount && member < buffer[0]; ++i) {
+        if (fds_[i] < 0) continue;
+        uint64_t value = buffer[3 + 2 * member++];
+        if (running > 0 && running < enabled)
+            value = static_cast<uint64_t>(static_cast<double>(value) * static_cast<double>(enabled) / static_cast<double>(running));
+        values[i] = value;
+    }
+    return values;
+}
+
+#else
+
+PerfCounters::PerfCounters() : error_("hardware counters need Linux perf_event_open") {
+    fds_.fill(-1);
+}
+
+PerfCounters::~PerfCounters() = default;
+
+PerfValues PerfCounters::read() const {
+    return {};
+}
+
+#endif
@@ -0,0 +1,66 @@
+/*
+ * This code is licensed under the GNU AGPLv3
+ * Copyright (c) 2025 GokbakarE
+ * Date: 28-08-2025
+ */
+
+#pragma once
+#ifndef PERFCOUNTERS_H
+#define PERFCOUNTERS_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+// Hardware events sampled by --perf.
+enum class PerfEvent : uint8_t {
+    Cycles,
+    Instructions,
+    BranchMisses,
+    L1dMisses,   // L1 data cache read misses
+    LlcMisses    // last-level cache misses
+};
+
+inline constexpr size_t PerfEventCount = 5;
+
+using PerfValues = std::array<uint64_t, PerfEventCount>;
+
+std::string_view perfEventName(PerfEvent event);
+
+// The calling thread's hardware counters, opened with perf_event_open(2) as
+// one group so a single read() samples all of them at the same instant.
+// Counting is limited to user space, which unprivileged processes may do
+// under the default perf_event_paranoid setting. Events the CPU or kernel
+// does not offer are left out of the group; when even the cycle counter is
+// refused, or off Linux, nothing is counted and error() says why. Running
+// out of file descriptors for any event is reported as such, not as missing
+// hardware.
+class PerfCounters {
+public:
+    PerfCounters();
+    ~PerfCounters();
+
+    PerfCounters(const PerfCounters&) = delete;
+    PerfCounters& operator=(const PerfCounters&) = delete;
+
+    bool available() const { return fds_[0] >= 0; }
+    bool has(PerfEvent event) const { return fds_[static_cast<size_t>(event)] >= 0; }
+    const std::string& error() const { return error_; }
+
+    // Whether opening failed because the process or system had no file
+    // descriptors left (EMFILE or ENFILE).
+    bool outOfFiles() const { return outOfFiles_; }
+
+    // Current counts since the group was opened, scaled up if the kernel had
+    // to multiplex the group; all zero when unavailable.
+    PerfValues read() const;
+
+private:
+    std::array<int, PerfEventCount> fds_;
+    std::string error_;
+    bool outOfFiles_ = false;
+};
+
+#endif
@@ -0,0 +1,107 @@
+/*
+ * This code is licensed under the GNU AGPLv3
+ * Copyright (c) 2025 GokbakarE
+ * Date: 28-08-2025
+ */
+
+#include "RenderTable.hpp"
+
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "InstructionTable.hpp"
+
+static constexpr size_t WordCount = 65536;
+static constexpr size_t EntryCount = IsaCount * WordCount;
+
+RenderTable::RenderTable(const std::span<const std::byte> blob) {
+    RenderTableHeader header;
+    if (blob.size() < sizeof header) throw std::runtime_error("Render table is truncated");
+    std::memcpy(&header, blob.data(), sizeof header);
+
+    if (std::memcmp(header.magic, RenderTableMagic, sizeof header.magic) != 0)
+        throw std::runtime_error("Not a render table");
+    if (header.version != RenderTableVersion || header.isaCount != IsaCount)
+        throw std::runtime_error("Render table was written by an incompatible version");
+    if (header.tableHash != decoderHash())
+        throw std::runtime_error("Render table was generated from a different decoder");
+    if (blob.size() < sizeof header + EntryCount * sizeof(uint32_t) + header.textSize)
+        throw std::runtime_error("Render table is truncated");
+    if (reinterpret_cast<uintptr_t>(blob.data()) % alignof(uint32_t) != 0)
+        throw std::runtime_error("Render table is misaligned");
+
+    entries_ = reinterpret_cast<const uint32_t*>(blob.data() + sizeof header);
+    text_ = reinterpret_cast<const char*>(blob.data() + sizeof header + EntryCount * sizeof(uint32_t));
+
+    // Checked once here so that render() can trust every entry.
+    for (size_t i = 0; i < EntryCount; ++i) {
+        const uint32_t entry = entries_[i];
+        if ((entry >> 26) > MaxInsnText || (entry & 0x3FFFFFF) + (entry >> 26) > header.textSize)
+            throw std::runtime_error("Render table is corrupt");
+    }
+}
+
+std::vector<std::byte> buildRenderTable() {
+    std::vector<uint32_t> entries(EntryCount);
+    std::string text;
+    std::unordered_map<std::string, uint32_t> offsets;
+
+    char rendered[MaxInsnText];
+    for (size_t isa = 0; isa < IsaCount; ++isa) {
+        for (size_t word = 0; word < WordCount; ++word) {
+            const auto isaValue = static_cast<ISA>(isa);
+            const size_t length = format(decode(static_cast<uint16_t>(word), isaValue), isaValue, rendered);
+
+            const auto [found, added] = offsets.try_emplace(std::string(rendered, length), static_cast<uint32_t>(text.size()));
+            if (added) text.append(rendered, length);
+            entries[isa << 16 | word] = static_cast<uint32_t>(length) << 26 | found->second;
+        }
+    }
+    if (text.size() > 0x3FFFFFF) throw std::runtime_error("Rendered text does not fit a render table");
+
+    RenderTableHeader header{};
+    std::memcpy(header.magic, RenderTableMagic, sizeof header.magic);
+    header.version = RenderTableVersion;
+    header.tableHash = decoderHash();
+    header.isaCount = IsaCount;
+    header.textSize = static_cast<uint32_t>(text.size());
+
+    std::vector<std::byte> blob(sizeof header + EntryCount * sizeof(uint32_t) + text.size());
+    std::memcpy(blob.data(), &header, sizeof header);
+    std::memcpy(blob.data() + sizeof header, entries.data(), EntryCount * sizeof(uint32_t));
+    std::memcpy(blob.data() + sizeof header + EntryCount * sizeof(uint32_t), text.data(), text.size());
+    return blob;
+}
+
+#if defined(DISSH_RENDER_TABLE) && defined(__ELF__)
+
+// Pulls the blob generated by "make render-table" into read-only data.
+asm(".pushsection .rodata\n"
+    ".balign 64\n"
+    ".globl dissh_render_table_begin\n"
+    ".hidden dissh_render_table_begin\n"
+    ".globl dissh_render_table_end\n"
+    ".hidden dissh_render_table_end\n"
+    "dissh_render_table_begin:\n"
+    ".incbin \"" DISSH_RENDER_TABLE "\"\n"
+    "dissh_render_table_end:\n"
+    ".popsection\n");
+
+extern "C" __attribute__((visibility("hidden"))) const std::byte dissh_render_table_begin[];
+extern "C" __attribute__((visibility("hidden"))) const std::byte dissh_render_table_end[];
+
+const RenderTable* embeddedRenderTable() {
+    static const RenderTable table(
+        {dissh_render_table_begin, static_cast<size_t>(dissh_render_table_end - dissh_render_table_begin)});
+    return &table;
+}
+
+#else
+
+const RenderTable* embeddedRenderTable() {
+    return nullptr;
+}
+
+#endif
@@ -0,0 +1,84 @@
+/*
+ * This code is licensed under the GNU AGPLv3
+ * Copyright (c) 2025 GokbakarE
+ * Date: 28-08-2025
+ */
+
+#pragma once
+#ifndef RENDERTABLE_H
+#define RENDERTABLE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "MappedFile.hpp"
+#include "SuperH.hpp"
+
+// The rendered text of every word in every ISA, precomputed. A render table
+// is a blob in host byte order laid out as
+//
+//   RenderTableHeader
+//   u32 entries[IsaCount][65536]   text length << 26 | text offset
+//   char text[header.textSize]     deduplicated texts, unterminated
+//
+// so rendering a word is one load and a memcpy. Blobs are written by
+// buildRenderTable() and either embedded in the binary (make render-table)
+// or mapped from a file, which lets processes share one page-cache copy.
+struct RenderTableHeader {
+    char magic[8];
+    uint32_t version;
+    // decoderHash() of the decoder the blob was generated with.
+    uint32_t tableHash;
+    uint32_t isaCount;
+    uint32_t textSize;
+};
+
+inline constexpr char RenderTableMagic[8] = {'D', 'i', 's', 'S', 'H', 'R', 'T', '\0'};
+// Bumped whenever the blob layout or the rendering of operands changes.
+inline constexpr uint32_t RenderTableVersion = 1;
+
+class RenderTable {
+public:
+    // Wraps blob, which must stay alive and be 4-byte aligned. Throws
+    // std::runtime_error when blob is not a render table for this decoder.
+    explicit RenderTable(std::span<const std::byte> blob);
+
+    // Writes the text of word into out, which must hold MaxInsnText
+    // characters, and returns its length. Same text as format(decode()).
+    size_t render(uint16_t word, ISA isa, char* out) const noexcept {
+        const uint32_t entry = entries_[static_cast<size_t>(isa) << 16 | word];
+        const size_t length = entry >> 26;
+        std::memcpy(out, text_ + (entry & 0x3FFFFFF), length);
+        return length;
+    }
+
+private:
+    const uint32_t* entries_;
+    const char* text_;
+};
+
+// A render table mapped from a file written with buildRenderTable(), shared
+// through the page cache by every process that maps it.
+class MappedRenderTable {
+public:
+    explicit MappedRenderTable(const std::string& path) : file_(path), table_(file_.bytes()) {}
+
+    const RenderTable& table() const { return table_; }
+
+private:
+    MappedFile file_;
+    RenderTable table_;
+};
+
+// Renders every word of every ISA into a render table blob.
+std::vector<std::byte> buildRenderTable();
+
+// The render table embedded at build time, or nullptr when the binary was
+// built without one.
+const RenderTable* embeddedRenderTable();
+
+#endif
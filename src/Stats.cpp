@@ -0,0 +1,140 @@
+/*
+ * This code is licensed under the GNU AGPLv3
+ * Copyright (c) 2025 GokbakarE
+ * Date: 28-08-2025
+ */
+
+#include "Stats.hpp"
+
+#include <algorithm>
+#include <iomanip>
+#include <string_view>
+
+Stats::Stats(const bool hardwareCounters) : hardwareCounters_(hardwareCounters) {}
+
+std::string Stats::perfError() const {
+    std::lock_guard lock(mutex_);
+    return perfError_;
+}
+
+bool Stats::perfOutOfFiles() const {
+    std::lock_guard lock(mutex_);
+    return perfOutOfFiles_;
+}
+
+bool Stats::perfHas(const PerfEvent event) const {
+    std::lock_guard lock(mutex_);
+    return perfHas_[static_cast<size_t>(event)];
+}
+
+// Opens the calling thread's hardware counters into slot, which keeps them
+// until the thread exits.
+void Stats::openPerf(Slot& slot) {
+    slot.perf = std::make_unique<PerfCounters>();
+    const PerfCounters& perf = *slot.perf;
+    slot.counters.perf = perf.available() ? &perf : nullptr;
+
+    std::lock_guard lock(mutex_);
+    if (!perf.available() && perfError_.empty()) {
+        perfError_ = perf.error();
+        perfOutOfFiles_ = perf.outOfFiles();
+    }
+    for (size_t i = 0; i < PerfEventCount; ++i) perfHas_[i] = perfHas_[i] || perf.has(static_cast<PerfEvent>(i));
+}
+
+ThreadStats& Stats::local() {
+    Slot& slot = threads_.local([] { return std::make_unique<Slot>(); }, [this](Slot& taken) {
+        if (hardwareCounters_) openPerf(taken);
+    });
+    return slot.counters;
+}
+
+ThreadStats Stats::total() const {
+    ThreadStats sum;
+    threads_.forEach([&](const Slot& slot) {
+        const ThreadStats& thread = slot.counters;
+        sum.bytesRead += thread.bytesRead;
+        sum.instructions += thread.instructions;
+        for (size_t i = 0; i < IsaCount; ++i) sum.fallbacks[i] += thread.fallbacks[i];
+        for (size_t i = 0; i < StatStageCount; ++i) sum.stages[i] += thread.stages[i];
+    });
+    return sum;
+}
+
+static constexpr std::string_view StageNames[StatStageCount] = {"load:", "decode:", "format:", "write:"};
+
+// Allocations per stage, for the allocation-tracking build. Work outside the
+// stages, such as opening files, shows up only in the process totals.
+static void printAllocations(const ThreadStats& total, std::ostream& out) {
+    const double decoded = std::max<double>(static_cast<double>(total.instructions), 1);
+    out << "Allocations:\n  " << std::left << std::setw(10) << "stage" << std::right;
+    for (const char* title : {"allocations", "allocs/insn", "bytes", "peak RSS +KB"}) out << std::setw(16) << title;
+    out << "\n";
+    for (size_t i = 0; i < StatStageCount; ++i) {
+        const StageCounts& stage = total.stages[i];
+        out << "  " << std::left << std::setw(10) << StageNames[i] << std::right << std::setw(16) << stage.allocations
+            << std::setw(16) << std::setprecision(4) << static_cast<double>(stage.allocations) / decoded
+            << std::setw(16) << stage.allocatedBytes << std::setw(16) << stage.peakRssGrowthKb << "\n";
+    }
+    const AllocationCounts process = processAllocations();
+    out << "  " << std::left << std::setw(10) << "process:" << std::right << std::setw(16) << process.allocations
+        << std::setw(16) << std::setprecision(4) << static_cast<double>(process.allocations) / decoded << std::setw(16)
+        << process.bytes << std::setw(16) << peakRssKb() << " KB peak\n";
+}
+
+void printStats(const Stats& stats, const std::chrono::nanoseconds wall, std::ostream& out) {
+    const ThreadStats total = stats.total();
+    const double seconds = std::chrono::duration<double>(wall).count();
+    const auto field = [&](std::string_view name) -> std::ostream& {
+        return out << "  " << std::left << std::setw(20) << name;
+    };
+
+    out << "Stats:\n" << std::fixed;
+    field("bytes read:") << total.bytesRead << "\n";
+    field("instructions:") << total.instructions << "\n";
+    for (size_t i = 0; i < IsaCount; ++i) {
+        if (total.fallbacks[i] > 0) field("word fallbacks:") << isaName(static_cast<ISA>(i)) << " " << total.fallbacks[i] << "\n";
+    }
+    for (size_t i = 0; i < StatStageCount; ++i)
+        field(StageNames[i]) << std::setprecision(3) << static_cast<double>(total.stages[i].nanoseconds) / 1e6 << " ms\n";
+    field("wall:") << std::setprecision(3) << seconds * 1e3 << " ms\n";
+    field("instructions/sec:") << std::setprecision(0)
+                                << (seconds > 0 ? static_cast<double>(total.instructions) / seconds : 0.0) << "\n";
+    if constexpr (AllocationTracking) printAllocations(total, out);
+
+    if (!stats.hardwareCounters()) return;
+    if (const std::string error = stats.perfError(); !error.empty()) {
+        if (stats.perfOutOfFiles())
+            out << "Hardware counters: out of file descriptors: " << error
+                << "; raise the open-file limit or use fewer --jobs; wall-clock only\n";
+        else
+            out << "Hardware counters unavailable: " << error << "; wall-clock only\n";
+        return;
+    }
+
+    // Misses are given per decoded instruction, so stages compare directly.
+    const double decoded = std::max<double>(static_cast<double>(total.instructions), 1);
+    const auto cell = [&](PerfEvent event, double value, int precision) {
+        out << std::right << std::setw(16);
+        if (stats.perfHas(event)) out << std::setprecision(precision) << value;
+        else out << "n/a";
+    };
+
+    out << "Hardware counters (user space):\n  " << std::left << std::setw(10) << "stage" << std::right;
+    for (const char* title : {"cycles", "instructions", "IPC", "br-miss/insn", "L1d-miss/insn", "LLC-miss/insn"})
+        out << std::setw(16) << title;
+    out << "\n";
+    for (size_t i = 0; i < StatStageCount; ++i) {
+        const PerfValues& events = total.stages[i].events;
+        const auto value = [&](PerfEvent event) { return static_cast<double>(events[static_cast<size_t>(event)]); };
+        out << "  " << std::left << std::setw(10) << StageNames[i];
+        cell(PerfEvent::Cycles, value(PerfEvent::Cycles), 0);
+        cell(PerfEvent::Instructions, value(PerfEvent::Instructions), 0);
+        const double cycles = value(PerfEvent::Cycles);
+        cell(PerfEvent::Instructions, cycles > 0 ? value(PerfEvent::Instructions) / cycles : 0, 2);
+        cell(PerfEvent::BranchMisses, value(PerfEvent::BranchMisses) / decoded, 4);
+        cell(PerfEvent::L1dMisses, value(PerfEvent::L1dMisses) / decoded, 4);
+        cell(PerfEvent::LlcMisses, value(PerfEvent::LlcMisses) / decoded, 4);
+        out << "\n";
+    }
+}
@@ -0,0 +1,187 @@
+/*
+ * This code is licensed under the GNU AGPLv3
+ * Copyright (c) 2025 GokbakarE
+ * Date: 28-08-2025
+ */
+
+#pragma once
+#ifndef STATS_H
+#define STATS_H
+
+#include <chrono>
+#include <cstddef>
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+
+#include "AllocationTracker.hpp"
+#include "PerfCounters.hpp"
+#include "SuperH.hpp"
+#include "ThreadSlots.hpp"
+
+// Pipeline stages timed by --stats.
+enum class StatStage : uint8_t {
+    Load,    // reading input bytes into halfwords
+    Decode,  // matching halfwords to opcodes
+    Format,  // rendering text
+    Write    // handing text to the output
+};
+
+inline constexpr size_t StatStageCount = 4;
+
+// What one stage cost: time, hardware events when sampling them, and, in the
+// allocation-tracking build, heap allocations and growth of the process's
+// peak resident set while the stage ran.
+struct StageCounts {
+    uint64_t nanoseconds = 0;
+    PerfValues events = {};
+    uint64_t allocations = 0;
+    uint64_t allocatedBytes = 0;
+    uint64_t peakRssGrowthKb = 0;
+
+    StageCounts& operator+=(const StageCounts& other) {
+        nanoseconds += other.nanoseconds;
+        for (size_t i = 0; i < PerfEventCount; ++i) events[i] += other.events[i];
+        allocations += other.allocations;
+        allocatedBytes += other.allocatedBytes;
+        peakRssGrowthKb += other.peakRssGrowthKb;
+        return *this;
+    }
+
+    StageCounts& operator-=(const StageCounts& other) {
+        nanoseconds -= other.nanoseconds;
+        for (size_t i = 0; i < PerfEventCount; ++i) events[i] -= other.events[i];
+        allocations -= other.allocations;
+        allocatedBytes -= other.allocatedBytes;
+        peakRssGrowthKb -= other.peakRssGrowthKb;
+        return *this;
+    }
+};
+
+// Counters of one thread. A thread only ever touches its own, so counting is
+// a plain add into a cache line no other thread writes.
+struct alignas(64) ThreadStats {
+    uint64_t bytesRead = 0;
+    uint64_t instructions = 0;
+    // Instructions rendered as "word..." because the ISA has no encoding for
+    // them, indexed by ISA.
+    uint64_t fallbacks[IsaCount] = {};
+    StageCounts stages[StatStageCount] = {};
+    // The thread's hardware counters, or null when not sampling them.
+    const PerfCounters* perf = nullptr;
+
+    StageCounts& stage(StatStage stage) { return stages[static_cast<size_t>(stage)]; }
+    const StageCounts& stage(StatStage stage) const { return stages[static_cast<size_t>(stage)]; }
+
+    // Takes what nested gained since before back out of outer, for a stage
+    // timed inside another one.
+    void subtractNested(StatStage outer, StatStage nested, const StageCounts& before) {
+        StageCounts gained = stage(nested);
+        gained -= before;
+        stage(outer) -= gained;
+    }
+};
+
+// Hot-path counters of a run, kept per thread and merged on demand.
+class Stats {
+public:
+    // With hardwareCounters, every counting thread also samples its
+    // PerfCounters around each stage. They are opened on the thread's first
+    // count and closed when it exits, so only running threads hold their
+    // file descriptors.
+    explicit Stats(bool hardwareCounters = false);
+
+    bool hardwareCounters() const { return hardwareCounters_; }
+
+    // Why hardware counters could not be opened, or empty.
+    std::string perfError() const;
+
+    // Whether they could not be opened for lack of file descriptors.
+    bool perfOutOfFiles() const;
+
+    // Whether the hardware counted event at all.
+    bool perfHas(PerfEvent event) const;
+
+    // The calling thread's counters, taken on first use from an exited
+    // thread or else created.
+    ThreadStats& local();
+
+    // Sum of every thread's counters. Call once the counting threads are done.
+    ThreadStats total() const;
+
+private:
+    struct Slot {
+        ThreadStats counters;
+        std::unique_ptr<PerfCounters> perf;
+
+        void threadExited() {
+            counters.perf = nullptr;
+            perf.reset();
+        }
+    };
+
+    void openPerf(Slot& slot);
+
+    bool hardwareCounters_;
+    // What opening hardware counters found on any thread so far.
+    mutable std::mutex mutex_;
+    std::string perfError_;
+    bool perfOutOfFiles_ = false;
+    std::array<bool, PerfEventCount> perfHas_ = {};
+    ThreadSlots<Slot> threads_;
+};
+
+// Adds the time between construction and destruction to one stage of
+// counters, with the events and allocations in between when tracking them.
+// Does nothing when counters is null.
+class StageTimer {
+public:
+    StageTimer(ThreadStats* counters, StatStage stage) : counters_(counters), stage_(stage) {
+        if (!counters_) return;
+        if (counters_->perf) startEvents_ = counters_->perf->read();
+        if constexpr (AllocationTracking) {
+            startAllocations_ = threadAllocations();
+            startRssKb_ = peakRssKb();
+        }
+        start_ = std::chrono::steady_clock::now();
+    }
+
+    ~StageTimer() {
+        if (!counters_) return;
+        const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start_);
+        StageCounts& counts = counters_->stage(stage_);
+        counts.nanoseconds += static_cast<uint64_t>(elapsed.count());
+        if (counters_->perf) {
+            const PerfValues end = counters_->perf->read();
+            for (size_t i = 0; i < PerfEventCount; ++i) counts.events[i] += end[i] - startEvents_[i];
+        }
+        if constexpr (AllocationTracking) {
+            const AllocationCounts end = threadAllocations();
+            counts.allocations += end.allocations - startAllocations_.allocations;
+            counts.allocatedBytes += end.bytes - startAllocations_.bytes;
+            counts.peakRssGrowthKb += peakRssKb() - startRssKb_;
+        }
+    }
+
+    StageTimer(const StageTimer&) = delete;
+    StageTimer& operator=(const StageTimer&) = delete;
+
+private:
+    ThreadStats* counters_;
+    StatStage stage_;
+    std::chrono::steady_clock::time_point start_;
+    PerfValues startEvents_{};
+    AllocationCounts startAllocations_{};
+    uint64_t startRssKb_ = 0;
+};
+
+// Writes the merged counters of stats and the instruction rate over wall as
+// a human-readable report. Stage times are summed over all threads. With
+// hardware counters, adds each stage's events, IPC and events per decoded
+// instruction; in the allocation-tracking build, each stage's allocations.
+void printStats(const Stats& stats, std::chrono::nanoseconds wall, std::ostream& out);
+
+#endif
@@ -0,0 +1,119 @@
+/*
+ * This code is licensed under the GNU AGPLv3
+ * Copyright (c) 2025 GokbakarE
+ * Date: 28-08-2025
+ */
+
+#include "SuperH.hpp"
+#include "InstructionTable.hpp"
+
+#include <algorithm>
+
+#include "SuperH1.hpp"
+#include "SuperH2.hpp"
+#include "SuperH3DSP.hpp"
+#include "SuperH3E.hpp"
+#include "SuperH3.hpp"
+#include "SuperH4A.hpp"
+#include "SuperH4.hpp"
+#include "SuperHDSP.hpp"
+
+DecodedInsn decode(const uint16_t word, const ISA isa) noexcept {
+    const DecodeTable& table = *DecodeTables[static_cast<size_t>(isa)];
+    return makeDecodedInsn(word, table[word]);
+}
+
+// Opcode ids are shared by all ISAs, so formatting only needs the opcode.
+size_t format(const DecodedInsn& insn, ISA, char* out) noexcept {
+    return formatInsn(insn, InstructionFormats, out);
+}
+
+std::string render(const DecodedInsn& insn, const ISA isa) {
+    char text[MaxInsnText];
+    return std::string(text, format(insn, isa, text));
+}
+
+size_t decodeBatch(const std::span<const uint16_t> words, const ISA isa, const std::span<DecodedInsn> out) noexcept {
+    const DecodeTable& table = *DecodeTables[static_cast<size_t>(isa)];
+    const size_t count = std::min(words.size(), out.size());
+    const uint16_t* in = words.data();
+    DecodedInsn* decoded = out.data();
+    for (size_t i = 0; i < count; ++i) decoded[i] = makeDecodedInsn(in[i], table[in[i]]);
+    return count;
+}
+
+RenderedBatch renderBatch(const std::span<const DecodedInsn> insns, const ISA isa, const std::span<char> text) noexcept {
+    RenderedBatch rendered{0, 0};
+    for (const DecodedInsn& insn : insns) {
+        if (text.size() - rendered.length < MaxInsnText + 1) break;
+        char* line = text.data() + rendered.length;
+        const size_t length = format(insn, isa, line);
+        line[length] = '\n';
+        rendered.length += length + 1;
+        ++rendered.count;
+    }
+    return rendered;
+}
+
+std::string disassemble(const uint16_t word, const ISA isa) {
+    return render(decode(word, isa), isa);
+}
+
+std::optional<ISA> isaFromFlag(const std::string_view isaFlag) {
+    if (isaFlag == "--SuperH1") return ISA::SuperH1;
+    if (isaFlag == "--SuperH2") return ISA::SuperH2;
+    if (isaFlag == "--SuperH3DSP") return ISA::SuperH3DSP;
+    if (isaFlag == "--SuperH3E") return ISA::SuperH3E;
+    if (isaFlag == "--SuperH3") return ISA::SuperH3;
+    if (isaFlag == "--SuperH4A") return ISA::SuperH4A;
+    if (isaFlag == "--SuperH4") return ISA::SuperH4;
+    if (isaFlag == "--SuperHDSP") return ISA::SuperHDSP;
+    return std::nullopt;
+}
+
+std::string_view isaName(const ISA isa) {
+    static constexpr std::string_view Names[IsaCount] = {
+        "SuperH1", "SuperH2", "SuperH3", "SuperH3E", "SuperH3DSP", "SuperH4", "SuperH4A", "SuperHDSP"
+    };
+    return Names[static_cast<size_t>(isa)];
+}
+
+// Renders a 16-character binary string; anything else is echoed back as a
+// "word" so the string API keeps its historic behaviour.
+std::string disassemble(const std::string_view binaryCode, const ISA isa) {
+    const auto word = binaryToWord(binaryCode);
+    if (!word) return std::string("word") + std::string(binaryCode);
+    return disassemble(*word, isa);
+}
+
+std::string SuperH1(const std::string_view binaryCode) {
+    return disassemble(binaryCode, ISA::SuperH1);
+}
+
+std::string SuperH2(const std::string_view binaryCode) {
+    return disassemble(binaryCode, ISA::SuperH2);
+}
+
+std::string SuperH3(const std::string_view binaryCode) {
+    return disassemble(binaryCode, ISA::SuperH3);
+}
+
+std::string SuperH3E(const std::string_view binaryCode) {
+    return disassemble(binaryCode, ISA::SuperH3E);
+}
+
+std::string SuperH3DSP(const std::string_view binaryCode) {
+    return disassemble(binaryCode, ISA::SuperH3DSP);
+}
+
+std::string SuperH4(const std::string_view binaryCode) {
+    return disassemble(binaryCode, ISA::SuperH4);
+}
+
+std::string SuperH4A(const std::string_view binaryCode) {
+    return disassemble(binaryCode, ISA::SuperH4A);
+}
+
+std::string SuperHDSP(const std::string_view binaryCode) {
+    return disassemble(binaryCode, ISA::SuperHDSP);
+}
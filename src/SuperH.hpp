@@ -0,0 +1,93 @@
+/*
+ * This code is licensed under the GNU AGPLv3
+ * Copyright (c) 2025 GokbakarE
+ * Date: 28-08-2025
+ */
+
+#pragma once
+#ifndef SUPERH_H
+#define SUPERH_H
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+
+#include "DecodeTable.hpp"
+
+enum class ISA : uint8_t {
+    SuperH1,
+    SuperH2,
+    SuperH3,
+    SuperH3E,
+    SuperH3DSP,
+    SuperH4,
+    SuperH4A,
+    SuperHDSP
+};
+
+inline constexpr size_t IsaCount = 8;
+
+constexpr uint8_t isaBit(ISA isa) {
+    return static_cast<uint8_t>(1u << static_cast<unsigned>(isa));
+}
+
+// One decoded halfword. opcode indexes the shared instruction table and is
+// NoOpcode when the word is not a valid instruction for the ISA; the operand fields are the raw
+// bit groups every SuperH format draws its operands from.
+struct DecodedInsn {
+    uint16_t word;
+    uint16_t opcode;
+    uint8_t rn;       // bits 11..8
+    uint8_t rm;       // bits 7..4
+    uint8_t imm8;     // bits 7..0
+    uint8_t disp4;    // bits 3..0
+    uint16_t disp12;  // bits 11..0
+};
+
+constexpr DecodedInsn makeDecodedInsn(uint16_t word, uint16_t opcode) {
+    return {
+        word,
+        opcode,
+        static_cast<uint8_t>((word >> 8) & 0xF),
+        static_cast<uint8_t>((word >> 4) & 0xF),
+        static_cast<uint8_t>(word & 0xFF),
+        static_cast<uint8_t>(word & 0xF),
+        static_cast<uint16_t>(word & 0xFFF)
+    };
+}
+
+// Upper bound on the text of one rendered instruction.
+inline constexpr size_t MaxInsnText = 48;
+
+DecodedInsn decode(uint16_t word, ISA isa) noexcept;
+
+// Writes the text of insn into out, which must hold at least MaxInsnText
+// characters, and returns its length. Nothing is allocated.
+size_t format(const DecodedInsn& insn, ISA isa, char* out) noexcept;
+
+std::string render(const DecodedInsn& insn, ISA isa);
+
+// Decodes min(words.size(), out.size()) halfwords into out and returns how
+// many were decoded. Never allocates and never throws.
+size_t decodeBatch(std::span<const uint16_t> words, ISA isa, std::span<DecodedInsn> out) noexcept;
+
+struct RenderedBatch {
+    size_t count;   // instructions rendered
+    size_t length;  // characters written
+};
+
+// Renders insns into text as newline-terminated lines, stopping at the first
+// instruction that might not fit. Never allocates and never throws.
+RenderedBatch renderBatch(std::span<const DecodedInsn> insns, ISA isa, std::span<char> text) noexcept;
+std::string disassemble(uint16_t word, ISA isa);
+std::string disassemble(std::string_view binaryCode, ISA isa);
+
+std::optional<ISA> isaFromFlag(std::string_view isaFlag);
+
+// "SuperH1" ... "SuperHDSP", the ISA's flag without the leading dashes.
+std::string_view isaName(ISA isa);
+
+#endif
@@ -0,0 +1,106 @@
+/*
+ * This code is licensed under the GNU AGPLv3
+ * Copyright (c) 2025 GokbakarE
+ * Date: 28-08-2025
+ */
+
+#include "TaskPool.hpp"
+
+#include <algorithm>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace {
+
+struct TaskQueue {
+    std::mutex mutex;
+    std::deque<size_t> tasks;
+
+    std::optional<size_t> popFront() {
+        std::lock_guard lock(mutex);
+        if (tasks.empty()) return std::nullopt;
+        const size_t task = tasks.front();
+        tasks.pop_front();
+        return task;
+    }
+
+    std::optional<size_t> stealBack() {
+        std::lock_guard lock(mutex);
+        if (tasks.empty()) return std::nullopt;
+        const size_t task = tasks.back();
+        tasks.pop_back();
+        return task;
+    }
+};
+
+}
+
+void runTasks(const size_t count, const unsigned threads, const std::function<void(size_t)>& task) {
+    const size_t workers = std::clamp<size_t>(threads, 1, std::max<size_t>(count, 1));
+    std::vector<TaskQueue> queues(workers);
+    for (size_t i = 0; i < count; ++i) queues[i % workers].tasks.push_back(i);
+
+    const auto work = [&](const size_t self) {
+        for (;;) {
+            std::optional<size_t> next = queues[self].popFront();
+            // Tasks are never added once running, so a full pass over the
+            // other queues finding nothing means all work has been claimed.
+            for (size_t offset = 1; !next && offset < workers; ++offset)
+                next = queues[(self + offset) % workers].stealBack();
+            if (!next) return;
+            task(*next);
+        }
+    };
+
+    std::vector<std::jthread> pool;
+    for (size_t i = 1; i < workers; ++i) pool.emplace_back(work, i);
+    work(0);
+}
+
+WorkerPool::~WorkerPool() {
+    {
+        std::lock_guard lock(mutex_);
+        closing_ = true;
+    }
+    changed_.notify_all();
+    workers_.clear();
+}
+
+void WorkerPool::start(std::function<void()> job) {
+    if (workers_.empty()) {
+        for (unsigned i = 0; i < std::max(threads_, 1u); ++i) workers_.emplace_back([this] { work(); });
+    }
+    {
+        std::lock_guard lock(mutex_);
+        job_ = std::move(job);
+        ++generation_;
+        running_ = static_cast<unsigned>(workers_.size());
+    }
+    changed_.notify_all();
+}
+
+void WorkerPool::wait() {
+    std::unique_lock lock(mutex_);
+    changed_.wait(lock, [&] { return running_ == 0; });
+}
+
+void WorkerPool::work() {
+    uint64_t seen = 0;
+    for (;;) {
+        {
+            std::unique_lock lock(mutex_);
+            changed_.wait(lock, [&] { return closing_ || generation_ != seen; });
+            if (closing_) return;
+            seen = generation_;
+        }
+        // job_ is only replaced once every thread has finished it.
+        job_();
+
+        std::lock_guard lock(mutex_);
+        if (--running_ == 0) changed_.notify_all();
+    }
+}
@@ -0,0 +1,60 @@
+/*
+ * This code is licensed under the GNU AGPLv3
+ * Copyright (c) 2025 GokbakarE
+ * Date: 28-08-2025
+ */
+
+#pragma once
+#ifndef TASKPOOL_H
+#define TASKPOOL_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Runs task(i) for every i in [0, count) on up to threads threads and returns
+// once all of them have finished. Tasks are dealt round-robin to per-thread
+// queues up front; a thread works its own queue from the front and, once it
+// is empty, steals from the back of the others. Dealing tasks largest-first
+// therefore starts every thread on big work and leaves the small tasks to
+// even out the tail. task must not throw.
+void runTasks(size_t count, unsigned threads, const std::function<void(size_t)>& task);
+
+// A fixed set of threads, started on first use and kept until destruction,
+// that each run the job last started until it returns. A caller with many
+// jobs in a row, such as the blocks of a stream, keeps the same threads for
+// all of them instead of starting new ones per job, so per-thread state is
+// set up once. The job must not throw.
+class WorkerPool {
+public:
+    explicit WorkerPool(unsigned threads) : threads_(threads) {}
+    ~WorkerPool();
+
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+
+    // Runs job on every thread and returns at once. The previous job must
+    // have been waited for.
+    void start(std::function<void()> job);
+
+    // Returns once every thread has returned from the job last started.
+    void wait();
+
+private:
+    void work();
+
+    unsigned threads_;
+    std::mutex mutex_;
+    std::condition_variable changed_;
+    std::function<void()> job_;
+    uint64_t generation_ = 0;
+    unsigned running_ = 0;
+    bool closing_ = false;
+    std::vector<std::jthread> workers_;
+};
+
+#endif
@@ -0,0 +1,100 @@
+/*
+ * This code is licensed under the GNU AGPLv3
+ * Copyright (c) 2025 GokbakarE
+ * Date: 28-08-2025
+ */
+
+#pragma once
+#ifndef THREADSLOTS_H
+#define THREADSLOTS_H
+
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+// Per-thread state of one owner, such as the counters of a Stats: every
+// thread that asks gets a slot of its own, and gives it back when it exits so
+// the next new thread takes it over instead of adding another. However many
+// threads come and go, there are never more slots than threads that were
+// running at once. Lookups after the first one per thread take no lock.
+//
+// Slots outlive the owner while an exiting thread may still give one back.
+// A Slot with a threadExited() member has it called on the exiting thread
+// just before its slot is given back.
+template <typename Slot>
+class ThreadSlots {
+public:
+    // The calling thread's slot. A thread without one takes a slot given back
+    // by an exited thread, or else make()'s new one, and passes it to take()
+    // before using it.
+    template <typename Make, typename Take>
+    Slot& local(Make&& make, Take&& take) {
+        thread_local Lease lease;
+        if (lease.shared != shared_) [[unlikely]] {
+            lease.giveBack();
+            Slot* slot;
+            {
+                std::lock_guard lock(shared_->mutex);
+                if (shared_->free.empty()) {
+                    slot = shared_->slots.emplace_back(make()).get();
+                } else {
+                    slot = shared_->free.back();
+                    shared_->free.pop_back();
+                }
+            }
+            take(*slot);
+            lease.shared = shared_;
+            lease.slot = slot;
+        }
+        return *lease.slot;
+    }
+
+    Slot& local() {
+        return local([] { return std::make_unique<Slot>(); }, [](Slot&) {});
+    }
+
+    // Calls fn on every slot, in use or given back, in the order they were
+    // made. Slots in use may be changing, so call once their threads are done
+    // when reading them.
+    template <typename Fn>
+    void forEach(Fn&& fn) {
+        std::lock_guard lock(shared_->mutex);
+        for (const std::unique_ptr<Slot>& slot : shared_->slots) fn(*slot);
+    }
+
+    template <typename Fn>
+    void forEach(Fn&& fn) const {
+        std::lock_guard lock(shared_->mutex);
+        for (const std::unique_ptr<Slot>& slot : shared_->slots) fn(std::as_const(*slot));
+    }
+
+private:
+    struct Shared {
+        std::mutex mutex;
+        std::vector<std::unique_ptr<Slot>> slots;
+        std::vector<Slot*> free;
+    };
+
+    // A thread's slot of the owner it used last, given back on thread exit
+    // or when the thread moves on to another owner.
+    struct Lease {
+        std::shared_ptr<Shared> shared;
+        Slot* slot = nullptr;
+
+        ~Lease() { giveBack(); }
+
+        void giveBack() {
+            if (!shared) return;
+            if constexpr (requires { slot->threadExited(); }) slot->threadExited();
+            // Keeps the slots alive past the lock even when the owner is gone.
+            const std::shared_ptr<Shared> owner = std::move(shared);
+            std::lock_guard lock(owner->mutex);
+            owner->free.push_back(std::exchange(slot, nullptr));
+        }
+    };
+
+    std::shared_ptr<Shared> shared_ = std::make_shared<Shared>();
+};
+
+#endif
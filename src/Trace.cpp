@@ -0,0 +1,92 @@
+/*
+ * This code is licensed under the GNU AGPLv3
+ * Copyright (c) 2025 GokbakarE
+ * Date: 28-08-2025
+ */
+
+#include "Trace.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <vector>
+
+#include <unistd.h>
+
+// A single-producer ring. Only the thread holding it writes events and head;
+// write() reads them after the producers have finished.
+struct Tracer::Ring {
+    Ring(size_t capacity, uint32_t lane)
+        : events(std::make_unique_for_overwrite<TraceEvent[]>(capacity)), capacity(capacity), lane(lane) {}
+
+    std::unique_ptr<TraceEvent[]> events;
+    size_t capacity;
+    uint32_t lane;
+    // Events ever recorded; the live ones are the last min(head, capacity).
+    std::atomic<uint64_t> head = 0;
+};
+
+// The creating thread takes the first lane.
+Tracer::Tracer(const size_t ringEvents)
+    : ringEvents_(std::max<size_t>(ringEvents, 1)), origin_(std::chrono::steady_clock::now()) {
+    local();
+}
+
+Tracer::~Tracer() = default;
+
+Tracer::Ring& Tracer::local() {
+    return rings_.local([this] { return std::make_unique<Ring>(ringEvents_, nextLane_++); }, [](Ring&) {});
+}
+
+void Tracer::record(const char* name, const uint64_t start, const uint64_t end, const uint64_t count) {
+    Ring& ring = local();
+    const uint64_t head = ring.head.load(std::memory_order_relaxed);
+    ring.events[head % ring.capacity] = {name, start, end, count};
+    ring.head.store(head + 1, std::memory_order_release);
+}
+
+uint64_t Tracer::dropped() const {
+    uint64_t dropped = 0;
+    rings_.forEach([&](const Ring& ring) {
+        const uint64_t head = ring.head.load(std::memory_order_acquire);
+        if (head > ring.capacity) dropped += head - ring.capacity;
+    });
+    return dropped;
+}
+
+void Tracer::write(std::ostream& out) const {
+    std::vector<const Ring*> rings;
+    rings_.forEach([&](const Ring& ring) { rings.push_back(&ring); });
+    std::sort(rings.begin(), rings.end(), [](const Ring* a, const Ring* b) { return a->lane < b->lane; });
+
+    const long pid = static_cast<long>(::getpid());
+    char line[256];
+    bool first = true;
+    const auto emit = [&] {
+        out << (first ? "\n" : ",\n") << line;
+        first = false;
+    };
+
+    out << "{\"displayTimeUnit\": \"ns\", \"otherData\": {\"dropped\": " << dropped() << "}, \"traceEvents\": [";
+    for (const Ring* ring : rings) {
+        char threadName[32] = "main";
+        if (ring->lane > 0) std::snprintf(threadName, sizeof threadName, "worker %u", ring->lane);
+        std::snprintf(line, sizeof line,
+                      "{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": %ld, \"tid\": %u, "
+                      "\"args\": {\"name\": \"%s\"}}",
+                      pid, ring->lane, threadName);
+        emit();
+
+        const uint64_t head = ring->head.load(std::memory_order_acquire);
+        for (uint64_t i = head > ring->capacity ? head - ring->capacity : 0; i < head; ++i) {
+            const TraceEvent& event = ring->events[i % ring->capacity];
+            std::snprintf(line, sizeof line,
+                          "{\"name\": \"%s\", \"ph\": \"X\", \"pid\": %ld, \"tid\": %u, \"ts\": %.3f, \"dur\": %.3f, "
+                          "\"args\": {\"count\": %llu}}",
+                          event.name, pid, ring->lane, static_cast<double>(event.start) / 1e3,
+                          static_cast<double>(event.end - event.start) / 1e3,
+                          static_cast<unsigned long long>(event.count));
+            emit();
+        }
+    }
+    out << "\n]}\n";
+}
@@ -0,0 +1,93 @@
+/*
+ * This code is licensed under the GNU AGPLv3
+ * Copyright (c) 2025 GokbakarE
+ * Date: 28-08-2025
+ */
+
+#pragma once
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <ostream>
+
+#include "ThreadSlots.hpp"
+
+// One completed span. name must be a string literal or otherwise outlive the
+// tracer; count is an optional size shown with the span, such as the number
+// of instructions or bytes it covered.
+struct TraceEvent {
+    const char* name;
+    uint64_t start;  // nanoseconds since the tracer was created
+    uint64_t end;
+    uint64_t count;
+};
+
+// Records timeline spans for --trace. Every thread appends to a ring buffer
+// of its own, so recording takes no lock and never waits on another thread;
+// once a ring is full its oldest events are overwritten. A thread takes its
+// ring the first time it records and gives it back when it exits, and the next
+// new thread continues in the same ring and lane. So there are only as many
+// rings, and lanes, as threads that recorded at the same time.
+class Tracer {
+public:
+    static constexpr size_t DefaultRingEvents = 1 << 18;
+
+    explicit Tracer(size_t ringEvents = DefaultRingEvents);
+    ~Tracer();
+
+    Tracer(const Tracer&) = delete;
+    Tracer& operator=(const Tracer&) = delete;
+
+    uint64_t now() const {
+        return static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - origin_).count());
+    }
+
+    void record(const char* name, uint64_t start, uint64_t end, uint64_t count = 0);
+
+    // Events lost to full rings.
+    uint64_t dropped() const;
+
+    // Writes every recorded span in the Chrome trace event format, one lane
+    // per ring, for chrome://tracing or Perfetto. Call once the recording
+    // threads are done.
+    void write(std::ostream& out) const;
+
+private:
+    struct Ring;
+
+    Ring& local();
+
+    size_t ringEvents_;
+    std::chrono::steady_clock::time_point origin_;
+    ThreadSlots<Ring> rings_;
+    std::atomic<uint32_t> nextLane_ = 0;
+};
+
+// Records the time between construction and destruction as one span. Does
+// nothing when tracer is null.
+class TraceSpan {
+public:
+    TraceSpan(Tracer* tracer, const char* name, uint64_t count = 0)
+        : tracer_(tracer), name_(name), count_(count), start_(tracer ? tracer->now() : 0) {}
+
+    ~TraceSpan() {
+        if (tracer_) tracer_->record(name_, start_, tracer_->now(), count_);
+    }
+
+    TraceSpan(const TraceSpan&) = delete;
+    TraceSpan& operator=(const TraceSpan&) = delete;
+
+private:
+    Tracer* tracer_;
+    const char* name_;
+    uint64_t count_;
+    uint64_t start_;
+};
+
+#endif
@@ -0,0 +1,147 @@
+/*
+ * This code is licensed under the GNU AGPLv3
+ * Copyright (c) 2025 GokbakarE
+ * Date: 28-08-2025
+ */
+
+#include "WordStream.hpp"
+
+#include <array>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+#include <poll.h>
+#include <unistd.h>
+
+#include "DecodeTable.hpp"
+
+// Bytes read from the input at a time.
+static constexpr size_t ReadBlock = 1 << 16;
+
+// Longest token answered in full; longer ones can only be invalid and are
+// answered with their first MaxToken characters.
+static constexpr size_t MaxToken = 64;
+
+std::optional<WordFormat> wordFormatFromName(std::string_view name) {
+    if (name == "binary") return WordFormat::Binary;
+    if (name == "hex") return WordFormat::Hex;
+    if (name == "raw") return WordFormat::Raw;
+    return std::nullopt;
+}
+
+std::optional<FlushPolicy> flushPolicyFromName(std::string_view name) {
+    if (name == "line") return FlushPolicy::Line;
+    if (name == "idle") return FlushPolicy::Idle;
+    if (name == "full") return FlushPolicy::Full;
+    return std::nullopt;
+}
+
+static bool isSpace(char c) {
+    return c == ' ' || c == '\n' || c == '\r' || c == '\t' || c == '\v' || c == '\f';
+}
+
+static std::optional<uint16_t> parseToken(std::string_view token, WordFormat format) {
+    if (format == WordFormat::Binary) return binaryToWord(token);
+    if (token.size() > 2 && token[0] == '0' && (token[1] == 'x' || token[1] == 'X')) token.remove_prefix(2);
+    return hexToWord(token);
+}
+
+static void writeWord(uint16_t word, const WordStreamOptions& options, OutputWriter& out) {
+    char* const line = out.reserve(MaxInsnText + 1);
+    const size_t length = format(decode(word, options.isa), options.isa, line);
+    line[length] = '\n';
+    out.commit(length + 1);
+    if (options.flush == FlushPolicy::Line) out.flush();
+}
+
+static void writeToken(std::string_view token, const WordStreamOptions& options, OutputWriter& out) {
+    if (const auto word = parseToken(token, options.format)) {
+        writeWord(*word, options, out);
+        return;
+    }
+
+    token = token.substr(0, MaxToken);
+    char* const line = out.reserve(4 + MaxToken + 1);
+    std::memcpy(line, "word", 4);
+    std::memcpy(line + 4, token.data(), token.size());
+    line[4 + token.size()] = '\n';
+    out.commit(4 + token.size() + 1);
+    if (options.flush == FlushPolicy::Line) out.flush();
+}
+
+// Answers the complete tokens or halfwords at the start of input and returns
+// how many bytes were consumed; the rest is an incomplete word to carry over.
+// skipping is set while the tail of an over-long token, already answered, is
+// still to come.
+static size_t answer(std::string_view input, bool final, bool& skipping, const WordStreamOptions& options,
+                     OutputWriter& out) {
+    if (options.format == WordFormat::Raw) {
+        const size_t count = input.size() / 2;
+        std::array<uint16_t, ReadBlock / 2> words;
+        loadHalfwords({reinterpret_cast<const std::byte*>(input.data()), count * 2}, options.endian, {words.data(), count});
+        for (size_t i = 0; i < count; ++i) writeWord(words[i], options, out);
+        return count * 2;
+    }
+
+    size_t position = 0;
+    if (skipping) {
+        while (position < input.size() && !isSpace(input[position])) ++position;
+        skipping = position == input.size();
+    }
+
+    for (;;) {
+        while (position < input.size() && isSpace(input[position])) ++position;
+        size_t end = position;
+        while (end < input.size() && !isSpace(input[end])) ++end;
+
+        if (end == position) return position;
+        if (end == input.size() && !final) {
+            if (end - position <= MaxToken) return position;
+            skipping = true;
+        }
+        writeToken(input.substr(position, end - position), options, out);
+        position = end;
+    }
+}
+
+// Whether a read of fd would return at once, with input or end of input.
+static bool readable(int fd) {
+    pollfd poller{fd, POLLIN, 0};
+    return ::poll(&poller, 1, 0) > 0;
+}
+
+void decodeWordStream(int fd, const WordStreamOptions& options, OutputWriter& out) {
+    // Room for a carried-over token in front of a full read.
+    std::string buffer(MaxToken + ReadBlock, '\0');
+    size_t carried = 0;
+    bool skipping = false;
+
+    for (;;) {
+        // Input already waiting is answered first; only a read that would
+        // block means everything so far has been answered.
+        if (options.flush == FlushPolicy::Idle && !readable(fd)) out.flush();
+
+        const ssize_t count = ::read(fd, buffer.data() + carried, ReadBlock);
+        if (count < 0) {
+            if (errno == EINTR) continue;
+            throw std::runtime_error(std::string("Failed to read input (") + std::strerror(errno) + ")");
+        }
+
+        const bool final = count == 0;
+        const std::string_view input(buffer.data(), carried + static_cast<size_t>(count));
+        const size_t consumed = answer(input, final, skipping, options, out);
+        if (final) {
+            if (consumed < input.size()) {
+                out.flush();
+                throw std::runtime_error("Input ends with an odd byte, half of a halfword");
+            }
+            break;
+        }
+
+        carried = input.size() - consumed;
+        std::memmove(buffer.data(), buffer.data() + consumed, carried);
+    }
+    out.flush();
+}
@@ -0,0 +1,57 @@
+/*
+ * This code is licensed under the GNU AGPLv3
+ * Copyright (c) 2025 GokbakarE
+ * Date: 28-08-2025
+ */
+
+#pragma once
+#ifndef WORDSTREAM_H
+#define WORDSTREAM_H
+
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+#include "ByteOrder.hpp"
+#include "OutputWriter.hpp"
+#include "SuperH.hpp"
+
+// How words are spelled on the input stream.
+enum class WordFormat : uint8_t {
+    Binary,  // whitespace-separated 16-character binary strings
+    Hex,     // whitespace-separated 4-digit hex halfwords, "0x" optional
+    Raw      // bare halfwords, two bytes each
+};
+
+// Parses "binary", "hex" or "raw".
+std::optional<WordFormat> wordFormatFromName(std::string_view name);
+
+// When decoded lines are handed to the output.
+enum class FlushPolicy : uint8_t {
+    Line,  // after every line
+    Idle,  // whenever all input read so far has been answered
+    Full   // only when the output buffer fills up, and at end of input
+};
+
+// Parses "line", "idle" or "full".
+std::optional<FlushPolicy> flushPolicyFromName(std::string_view name);
+
+struct WordStreamOptions {
+    ISA isa = ISA::SuperH4;
+    WordFormat format = WordFormat::Binary;
+    // Byte order of raw input.
+    Endian endian = Endian::Big;
+    FlushPolicy flush = FlushPolicy::Idle;
+};
+
+// Reads words from fd until end of input and writes one decoded instruction
+// per word and line, in input order. Text tokens that are not a valid word
+// are answered with "word" followed by the token, as disassemble() does.
+// With FlushPolicy::Idle the reply to everything read so far is flushed
+// when no more input is ready, just before blocking for it, so a caller can
+// use this as a co-process, writing requests and reading answers over pipes.
+// Throws std::runtime_error when fd cannot be read, or once every whole
+// halfword is answered when raw input ends with an odd byte.
+void decodeWordStream(int fd, const WordStreamOptions& options, OutputWriter& out);
+
+#endif
@@ -0,0 +1,228 @@
+/*
+ * This code is licensed under the GNU AGPLv3
+ * Copyright (c) 2025 GokbakarE
+ * Date: 28-08-2025
+ */
+
+// Golden corpus of the decoder: the rendering of every 16-bit word by each of
+// the eight ISA functions, reduced to a 32-bit hash per word and a hash per
+// ISA. Only the string API every version of the decoder has had is used, so
+// the same source builds against an older tree to write the reference file
+// and against the current one to check it.
+//
+// Usage: DisSHGolden.elf --write <file>
+//        DisSHGolden.elf --check <file> [--jobs N] [--report N]
+//
+// File layout, all integers little-endian:
+//   char magic[8] "DisSHGD\0"
+//   u32 version, u32 isaCount, u32 wordCount
+//   u32 isaHash[isaCount]
+//   u32 wordHash[isaCount][wordCount]
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "SuperH1.hpp"
+#include "SuperH2.hpp"
+#include "SuperH3.hpp"
+#include "SuperH3DSP.hpp"
+#include "SuperH3E.hpp"
+#include "SuperH4.hpp"
+#include "SuperH4A.hpp"
+#include "SuperHDSP.hpp"
+
+static constexpr char GoldenMagic[8] = {'D', 'i', 's', 'S', 'H', 'G', 'D', '\0'};
+static constexpr uint32_t GoldenVersion = 1;
+static constexpr uint32_t WordCount = 65536;
+static constexpr size_t HeaderSize = sizeof GoldenMagic + 3 * 4;
+
+// Words hashed by one task.
+static constexpr uint32_t TaskWords = 4096;
+
+struct IsaFunction {
+    const char* name;
+    std::string (*function)(std::string_view);
+};
+
+static constexpr IsaFunction IsaFunctions[] = {
+    {"SuperH1", SuperH1},
+    {"SuperH2", SuperH2},
+    {"SuperH3", SuperH3},
+    {"SuperH3E", SuperH3E},
+    {"SuperH3DSP", SuperH3DSP},
+    {"SuperH4", SuperH4},
+    {"SuperH4A", SuperH4A},
+    {"SuperHDSP", SuperHDSP}
+};
+
+static constexpr uint32_t IsaCount = static_cast<uint32_t>(std::size(IsaFunctions));
+
+static constexpr uint32_t FnvOffset = 2166136261u;
+static constexpr uint32_t FnvPrime = 16777619u;
+
+static uint32_t fnv1a(std::string_view text, uint32_t hash = FnvOffset) {
+    for (const char c : text) hash = (hash ^ static_cast<uint8_t>(c)) * FnvPrime;
+    return hash;
+}
+
+static std::string binaryString(uint32_t word) {
+    std::string binary(16, '0');
+    for (int bit = 0; bit < 16; ++bit)
+        if (word & (0x8000u >> bit)) binary[bit] = '1';
+    return binary;
+}
+
+// The hash of every word for every ISA, indexed [isa * WordCount + word],
+// computed by threads workers.
+static std::vector<uint32_t> hashWords(unsigned threads) {
+    std::vector<uint32_t> hashes(size_t{IsaCount} * WordCount);
+    constexpr uint32_t TaskCount = IsaCount * (WordCount / TaskWords);
+    std::atomic<uint32_t> nextTask = 0;
+
+    auto worker = [&] {
+        for (uint32_t task; (task = nextTask++) < TaskCount;) {
+            const uint32_t isa = task / (WordCount / TaskWords);
+            const uint32_t first = task % (WordCount / TaskWords) * TaskWords;
+            for (uint32_t word = first; word < first + TaskWords; ++word)
+                hashes[size_t{isa} * WordCount + word] = fnv1a(IsaFunctions[isa].function(binaryString(word)));
+        }
+    };
+
+    std::vector<std::jthread> workers;
+    for (unsigned i = 1; i < threads; ++i) workers.emplace_back(worker);
+    worker();
+    return hashes;
+}
+
+// Hash of one ISA's word hashes, in word order.
+static uint32_t isaHash(const uint32_t* wordHashes) {
+    uint32_t hash = FnvOffset;
+    for (uint32_t word = 0; word < WordCount; ++word) {
+        for (int shift = 0; shift < 32; shift += 8)
+            hash = (hash ^ ((wordHashes[word] >> shift) & 0xFF)) * FnvPrime;
+    }
+    return hash;
+}
+
+static void put32(std::vector<char>& out, uint32_t value) {
+    for (int shift = 0; shift < 32; shift += 8) out.push_back(static_cast<char>(value >> shift));
+}
+
+static uint32_t get32(const char* in) {
+    uint32_t value = 0;
+    for (int i = 3; i >= 0; --i) value = value << 8 | static_cast<uint8_t>(in[i]);
+    return value;
+}
+
+static void writeGolden(const std::string& path, unsigned threads) {
+    const std::vector<uint32_t> hashes = hashWords(threads);
+
+    std::vector<char> out(GoldenMagic, GoldenMagic + sizeof GoldenMagic);
+    put32(out, GoldenVersion);
+    put32(out, IsaCount);
+    put32(out, WordCount);
+    for (uint32_t isa = 0; isa < IsaCount; ++isa) put32(out, isaHash(&hashes[size_t{isa} * WordCount]));
+    for (const uint32_t hash : hashes) put32(out, hash);
+
+    std::ofstream file(path, std::ios::binary);
+    if (!file.write(out.data(), static_cast<std::streamsize>(out.size())))
+        throw std::runtime_error("Failed to write " + path);
+}
+
+// Compares the linked decoder against the golden file at path and prints
+// up to report divergent words per ISA. Returns whether everything matched.
+static bool checkGolden(const std::string& path, unsigned threads, size_t report) {
+    std::ifstream file(path, std::ios::binary);
+    const std::vector<char> golden{std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+    if (!file.eof() && file.fail()) throw std::runtime_error("Failed to read " + path);
+
+    const size_t expectedSize = HeaderSize + IsaCount * 4 + size_t{IsaCount} * WordCount * 4;
+    if (golden.size() < HeaderSize || std::memcmp(golden.data(), GoldenMagic, sizeof GoldenMagic) != 0)
+        throw std::runtime_error("Not a golden file: " + path);
+    const char* header = golden.data() + sizeof GoldenMagic;
+    if (get32(header) != GoldenVersion) throw std::runtime_error("Unsupported golden file version: " + path);
+    if (get32(header + 4) != IsaCount || get32(header + 8) != WordCount || golden.size() != expectedSize)
+        throw std::runtime_error("Golden file does not match this tool's layout: " + path);
+
+    const std::vector<uint32_t> hashes = hashWords(threads);
+    const char* isaHashes = golden.data() + HeaderSize;
+    const char* wordHashes = isaHashes + IsaCount * 4;
+
+    bool matched = true;
+    for (uint32_t isa = 0; isa < IsaCount; ++isa) {
+        const uint32_t* actual = &hashes[size_t{isa} * WordCount];
+        if (isaHash(actual) == get32(isaHashes + isa * 4)) {
+            std::cout << IsaFunctions[isa].name << ": OK\n";
+            continue;
+        }
+
+        matched = false;
+        size_t diverged = 0;
+        for (uint32_t word = 0; word < WordCount; ++word) {
+            if (actual[word] == get32(wordHashes + (size_t{isa} * WordCount + word) * 4)) continue;
+            if (diverged++ < report) {
+                char hex[5];
+                std::snprintf(hex, sizeof hex, "%04x", word);
+                std::cout << "  " << IsaFunctions[isa].name << " [" << hex << "] -> "
+                          << IsaFunctions[isa].function(binaryString(word)) << "\n";
+            }
+        }
+        std::cout << IsaFunctions[isa].name << ": " << diverged << " divergent words\n";
+    }
+    return matched;
+}
+
+static void printUsage(const char* progName) {
+    std::cerr << "Usage:\n"
+              << "  " << progName << " --write <file> [--jobs N]\n"
+              << "  " << progName << " --check <file> [--jobs N] [--report N]\n";
+}
+
+int main(int argc, char* argv[]) {
+    if (argc < 3) {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    const std::string_view mode = argv[1];
+    const std::string path = argv[2];
+    unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+    size_t report = 10;
+    for (int i = 3; i < argc; ++i) {
+        const std::string_view arg = argv[i];
+        if (i + 1 < argc && arg == "--jobs") {
+            threads = static_cast<unsigned>(std::max(1, std::atoi(argv[++i])));
+        } else if (i + 1 < argc && arg == "--report") {
+            report = static_cast<size_t>(std::max(0, std::atoi(argv[++i])));
+        } else {
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+
+    try {
+        if (mode == "--write") {
+            writeGolden(path, threads);
+            return 0;
+        }
+        if (mode == "--check") return checkGolden(path, threads, report) ? 0 : 1;
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << "\n";
+        return 1;
+    }
+
+    printUsage(argv[0]);
+    return 1;
+}